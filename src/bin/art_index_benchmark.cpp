@@ -0,0 +1,95 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/table.hpp"
+
+// Compares point lookups with a TableScan on tables with and without AdaptiveRadixTreeIndexes, once on an int64 and
+// once on a string column. Both tables are dictionary-compressed, so the scan without index uses the value id scan.
+//
+// Usage: hyriseArtIndexBenchmark [row_count] [lookup_count]
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::shared_ptr<Table> create_table(const uint64_t row_count) {
+  auto table = std::make_shared<Table>(100'000);
+  table->add_column("id", "long");
+  table->add_column("name", "string");
+
+  std::vector<int64_t> ids(row_count);
+  std::vector<std::string> names(row_count);
+  std::mt19937_64 random_engine(42);
+  for (auto row = uint64_t{0}; row < row_count; ++row) {
+    ids[row] = static_cast<int64_t>(random_engine() % row_count);
+    names[row] = "customer#" + std::to_string(ids[row]);
+  }
+  table->append_columns(std::move(ids), std::move(names));
+  table->compress_chunks(ChunkID{0}, table->chunk_count(), 1);
+  return table;
+}
+
+// returns the average time of one lookup in microseconds
+double run_lookups(const std::shared_ptr<Table>& table, const ColumnID column_id,
+                   const std::vector<AllTypeVariant>& search_values) {
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto found_rows = uint64_t{0};
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& search_value : search_values) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, column_id, ScanType::OpEquals, search_value);
+    table_scan->execute();
+    found_rows += table_scan->get_output()->row_count();
+  }
+  const auto microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  // printing the result keeps the compiler from optimizing the lookups away
+  std::cout << "  (" << found_rows << " rows found)";
+  return microseconds / search_values.size();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000ull;
+  const auto lookup_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100ull;
+
+  const auto table = create_table(row_count);
+  const auto indexed_table = create_table(row_count);
+  for (ChunkID chunk_id{0}; chunk_id < indexed_table->chunk_count(); ++chunk_id) {
+    auto& chunk = indexed_table->get_chunk(chunk_id);
+    chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+    chunk.create_index<AdaptiveRadixTreeIndex>({ColumnID{1}});
+  }
+
+  std::vector<AllTypeVariant> ids;
+  std::vector<AllTypeVariant> names;
+  std::mt19937_64 random_engine(7);
+  for (auto lookup = uint64_t{0}; lookup < lookup_count; ++lookup) {
+    const auto id = static_cast<int64_t>(random_engine() % row_count);
+    ids.emplace_back(id);
+    names.emplace_back("customer#" + std::to_string(id));
+  }
+
+  std::cout << "Point lookups on " << row_count << " rows in " << table->chunk_count() << " chunks" << std::endl;
+  for (const auto& column_id : {ColumnID{0}, ColumnID{1}}) {
+    const auto& search_values = column_id == ColumnID{0} ? ids : names;
+    std::cout << std::setw(8) << table->column_type(column_id) << ": scan";
+    const auto scan_time = run_lookups(table, column_id, search_values);
+    std::cout << " " << std::fixed << std::setprecision(1) << scan_time << " us/lookup, index";
+    const auto index_time = run_lookups(indexed_table, column_id, search_values);
+    std::cout << " " << index_time << " us/lookup, speedup " << scan_time / index_time << "x" << std::endl;
+  }
+
+  return 0;
+}
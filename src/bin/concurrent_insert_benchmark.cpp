@@ -0,0 +1,69 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/table_inserter.hpp"
+
+// Measures the insert throughput of TableInserters writing to one table from an increasing number of threads.
+//
+// Usage: hyriseConcurrentInsertBenchmark [rows_per_thread] [max_thread_count]
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+double insert_rows(const uint32_t thread_count, const uint64_t rows_per_thread) {
+  Table table(100'000);
+  table.add_column("id", "long");
+  table.add_column("name", "string");
+
+  const auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> threads;
+  for (auto thread_index = 0u; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back([&, thread_index]() {
+      TableInserter inserter(table);
+      for (auto row = uint64_t{0}; row < rows_per_thread; ++row) {
+        const auto id = static_cast<int64_t>(thread_index * rows_per_thread + row);
+        inserter.append({id, "customer#" + std::to_string(id % 1000)});
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  if (table.row_count() != thread_count * rows_per_thread) {
+    std::cerr << "Expected " << thread_count * rows_per_thread << " rows, found " << table.row_count() << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  return static_cast<double>(table.row_count()) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto rows_per_thread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000ull;
+  const auto max_thread_count = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 16ul;
+
+  std::cout << "Inserting " << rows_per_thread << " rows per thread" << std::endl;
+  std::cout << std::setw(8) << "threads" << std::setw(16) << "rows/s" << std::setw(10) << "scaling" << std::endl;
+
+  double single_thread_throughput = 0;
+  for (auto thread_count = 1ul; thread_count <= max_thread_count; thread_count *= 2) {
+    const auto throughput = insert_rows(static_cast<uint32_t>(thread_count), rows_per_thread);
+    if (thread_count == 1) single_thread_throughput = throughput;
+
+    std::cout << std::setw(8) << thread_count << std::setw(16) << std::fixed << std::setprecision(0) << throughput
+              << std::setw(9) << std::setprecision(2) << throughput / single_thread_throughput << "x" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../lib/all_type_variant.hpp"
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/dictionary_encoder.hpp"
+#include "../lib/storage/value_column.hpp"
+
+// Compares the hash-based dictionary_encode() with the previous sort + std::map approach for every column type.
+//
+// Usage: hyriseDictionaryEncodingBenchmark [row_count] [distinct_count]
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// the previous implementation: sort a copy of all values, then look each row up in a std::map
+template <typename T>
+DictionaryEncoding<T> sort_and_map_encode(const std::vector<T>& values) {
+  DictionaryEncoding<T> encoding;
+  encoding.dictionary = std::vector<T>(values.begin(), values.end());
+  std::sort(encoding.dictionary.begin(), encoding.dictionary.end());
+  encoding.dictionary.erase(std::unique(encoding.dictionary.begin(), encoding.dictionary.end()),
+                            encoding.dictionary.end());
+
+  std::map<T, ValueID> value_ids;
+  encoding.value_ids.reserve(values.size());
+  for (const auto& value : values) {
+    auto it = value_ids.find(value);
+    if (it == value_ids.end()) {
+      const auto dictionary_it = std::lower_bound(encoding.dictionary.begin(), encoding.dictionary.end(), value);
+      it = value_ids.emplace(value, ValueID(std::distance(encoding.dictionary.begin(), dictionary_it))).first;
+    }
+    encoding.value_ids.push_back(it->second);
+  }
+  return encoding;
+}
+
+template <typename T>
+T make_value(const uint64_t number) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return "customer#" + std::to_string(number);
+  } else if constexpr (std::is_floating_point<T>::value) {
+    return static_cast<T>(number) * T{0.25};
+  } else {
+    return static_cast<T>(number);
+  }
+}
+
+template <typename Functor>
+double measure_milliseconds(const Functor& functor) {
+  const auto start = std::chrono::steady_clock::now();
+  functor();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const auto row_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000ull;
+  const auto distinct_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100'000ull;
+
+  std::cout << "Encoding " << row_count << " rows with " << distinct_count << " distinct values" << std::endl;
+  std::cout << std::setw(8) << "type" << std::setw(16) << "sort+map [ms]" << std::setw(16) << "hash [ms]"
+            << std::setw(23) << "DictionaryColumn [ms]" << std::setw(10) << "speedup" << std::endl;
+
+  for (const auto& type_string : {"int", "long", "float", "double", "string"}) {
+    resolve_data_type(type_string, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto value_column = std::make_shared<ValueColumn<ColumnDataType>>();
+      std::mt19937_64 generator{42};
+      std::uniform_int_distribution<uint64_t> distribution{0, distinct_count - 1};
+      std::vector<ColumnDataType> values;
+      values.reserve(row_count);
+      for (auto row = 0ull; row < row_count; ++row) {
+        values.push_back(make_value<ColumnDataType>(distribution(generator)));
+      }
+      for (const auto& value : values) value_column->append(value);
+
+      DictionaryEncoding<ColumnDataType> reference_encoding, encoding;
+      const auto sort_and_map_ms = measure_milliseconds([&]() { reference_encoding = sort_and_map_encode(values); });
+      const auto hash_ms = measure_milliseconds([&]() { encoding = dictionary_encode(values); });
+      const auto column_ms = measure_milliseconds([&]() { DictionaryColumn<ColumnDataType>{value_column}; });
+
+      if (encoding.dictionary != reference_encoding.dictionary || encoding.value_ids != reference_encoding.value_ids) {
+        std::cerr << "Encodings differ for type " << type_string << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+
+      std::cout << std::setw(8) << type_string << std::setw(16) << std::fixed << std::setprecision(1)
+                << sort_and_map_ms << std::setw(16) << hash_ms << std::setw(23) << column_ms << std::setw(9)
+                << std::setprecision(2) << sort_and_map_ms / hash_ms << "x" << std::endl;
+    });
+  }
+
+  return 0;
+}
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 
+#include "null_value.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -30,6 +31,7 @@ namespace detail {
 
 // clang-format off
 #define COLUMN_TYPES                                  (int32_t) (int64_t) (float)  (double)  (std::string)    // NOLINT
+#define INTEGRAL_COLUMN_TYPES                         (int32_t) (int64_t)                                     // NOLINT
 static constexpr auto type_strings = hana::make_tuple("int",    "long",   "float", "double", "string"     );  // NOLINT
 // clang-format on
 
@@ -57,8 +59,11 @@ struct to_pair {
 // Converts the tuples into pairs
 static constexpr auto column_types = hana::transform(column_types_as_tuples, to_pair{});  // NOLINT
 
+// Prepends NullValue to the column types, columns themselves are never of type NullValue
+static constexpr auto types_including_null = hana::prepend(types, hana::type_c<NullValue>);
+
 // Converts tuple to mpl vector
-using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
+using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types_including_null));
 
 // Creates boost::variant from mpl vector
 using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
@@ -66,10 +71,16 @@ using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVecto
 }  // namespace detail
 
 static constexpr auto types = detail::types;
+static constexpr auto types_including_null = detail::types_including_null;
 static constexpr auto column_types = detail::column_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// a default-constructed AllTypeVariant holds its first type, i.e., NullValue
+static const auto NULL_VALUE = AllTypeVariant{};
+
+inline bool variant_is_null(const AllTypeVariant& variant) { return variant.which() == 0; }
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
@@ -88,6 +99,12 @@ using AllTypeVariant = detail::AllTypeVariant;
   BOOST_PP_SEQ_FOR_EACH(EXPLICIT_INSTANTIATION, template_class, COLUMN_TYPES) \
   static_assert(true, "End call of macro with a semicolon")
 
+// Explicitly instantiates the given template class for the integral types in COLUMN_TYPES,
+// e.g., for encodings that rely on integer arithmetic
+#define EXPLICITLY_INSTANTIATE_INTEGRAL_COLUMN_TYPES(template_class)                   \
+  BOOST_PP_SEQ_FOR_EACH(EXPLICIT_INSTANTIATION, template_class, INTEGRAL_COLUMN_TYPES) \
+  static_assert(true, "End call of macro with a semicolon")
+
 /**@}*/
 
 }  // namespace opossum
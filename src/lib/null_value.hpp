@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ostream>
+
+namespace opossum {
+
+// NullValue is the type of NULL in an AllTypeVariant. Columns do not store NullValues, nullable columns mark their
+// NULL rows in a ValidityBitmap instead (see BaseColumn::validity).
+//
+// To make AllTypeVariants comparable and sortable, e.g., when comparing tables in tests, all NullValues are equal.
+// Predicates, in contrast, follow SQL and never hold for NULL.
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return true; }
+
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -14,7 +15,14 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+void AbstractOperator::execute() {
+  _intermediate_arena = std::make_unique<std::pmr::monotonic_buffer_resource>();
+  _output_arena = std::make_shared<std::pmr::monotonic_buffer_resource>();
+  _output = _on_execute();
+  // all intermediate results are released here, the PosLists of the output keep their arena alive on their own
+  _intermediate_arena.reset();
+  _output_arena.reset();
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   // TODO(anyone): You should place some meaningful checks here
@@ -26,4 +34,18 @@ std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { retur
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
 
+std::pmr::memory_resource* AbstractOperator::_memory_resource() const {
+  DebugAssert(_intermediate_arena, "The arena of an operator can only be used during its execution.");
+  return _intermediate_arena.get();
+}
+
+std::shared_ptr<PosList> AbstractOperator::_make_pos_list(const size_t capacity) const {
+  DebugAssert(_output_arena, "The arena of an operator can only be used during its execution.");
+  // the deleter holds a reference to the arena, which is destroyed after the PosList
+  auto pos_list = std::shared_ptr<PosList>(new PosList(_output_arena.get()),
+                                           [arena = _output_arena](PosList* pos_list) { delete pos_list; });
+  pos_list->reserve(capacity);
+  return pos_list;
+}
+
 }  // namespace opossum
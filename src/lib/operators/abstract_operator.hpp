@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,12 @@ class Table;
 //
 // Operators shall not be executed twice.
 //
+// Each execution gets two monotonic arenas: one for intermediate results, which is released at the end of the
+// execution, and one for the PosLists of the output, which is released when the last of them is gone. Allocating from
+// an arena is a pointer bump. An arena requests larger blocks from the global heap as it grows and releases all of
+// them at once, so many small allocations are batched into a few large ones and freed in bulk. Memory that is freed
+// earlier is not reused, so the PosLists of the output are allocated at their final size.
+//
 // Find more information about operators in our Wiki: https://github.com/hyrise/hyrise/wiki/operator-concept
 
 class AbstractOperator : private Noncopyable {
@@ -54,12 +61,25 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
+  // Returns the arena for intermediate results of the current execution, which must only be used by the thread
+  // executing the operator. Memory allocated from it must not be used after _on_execute() returns.
+  std::pmr::memory_resource* _memory_resource() const;
+
+  // Returns an empty PosList with the given capacity that is allocated from the output arena of the current execution
+  // and keeps the arena alive, so that it can be handed out as part of the output (e.g., to ReferenceColumns) and
+  // outlive the operator. The PosList should not grow beyond its capacity, which would leave its old buffer behind.
+  std::shared_ptr<PosList> _make_pos_list(size_t capacity) const;
+
   // Shared pointers to input operators, can be nullptr.
   std::shared_ptr<const AbstractOperator> _input_left;
   std::shared_ptr<const AbstractOperator> _input_right;
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  // the arenas of the current execution, nullptr outside of execute()
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> _intermediate_arena;
+  std::shared_ptr<std::pmr::monotonic_buffer_resource> _output_arena;
 };
 
 }  // namespace opossum
@@ -0,0 +1,21 @@
+#include "export_binary.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/binary_table.hpp"
+
+namespace opossum {
+
+ExportBinary::ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name)
+    : AbstractOperator(in), _file_name(file_name) {}
+
+const std::string& ExportBinary::file_name() const { return _file_name; }
+
+std::shared_ptr<const Table> ExportBinary::_on_execute() {
+  const auto table = _input_table_left();
+  write_binary_table(*table, _file_name);
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Writes its input table to a file in the binary table format (see write_binary_table) and passes the table on.
+// Encoded chunks are written in their encoding, so they are not re-encoded when the file is imported again. The
+// ReferenceColumns of operator results are materialized chunk by chunk.
+class ExportBinary : public AbstractOperator {
+ public:
+  ExportBinary(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name);
+
+  const std::string& file_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+};
+
+}  // namespace opossum
@@ -0,0 +1,206 @@
+#include "export_csv.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
+#include "utils/table_file_reader.hpp"
+
+namespace opossum {
+
+namespace {
+
+// the fields of one column of a chunk, field i is text[offsets[i], offsets[i + 1])
+struct FormattedColumn {
+  std::string text;
+  std::vector<size_t> offsets{0};
+
+  void finish_field() { offsets.push_back(text.size()); }
+};
+
+// fields are not quoted, so they must not contain the delimiter or line breaks
+bool is_valid_field(const std::string& field, const char delimiter) {
+  const char forbidden_characters[] = {delimiter, '\n', '\r', '\0'};
+  return field.find_first_of(forbidden_characters) == std::string::npos;
+}
+
+template <typename T>
+void append_value(std::string& text, const T& value, const char delimiter, const bool nullable) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    if (!is_valid_field(value, delimiter)) Fail("ExportCsv: Strings must not contain the delimiter or line breaks.");
+    // the string would be read as NULL
+    if (nullable && value == TBL_NULL_FIELD) Fail("ExportCsv: Nullable string columns must not contain \"null\".");
+    text += value;
+  } else {
+    // large enough for the longest representation of any double
+    char buffer[64];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    text.append(buffer, result.ptr);
+  }
+}
+
+template <typename T>
+FormattedColumn format_column(const BaseColumn& column, const char delimiter, const bool nullable) {
+  FormattedColumn formatted;
+  formatted.offsets.reserve(column.size() + 1);
+
+  const auto validity = column.validity();
+  const auto format_rows = [&](const auto& get_value) {
+    for (size_t row = 0; row < column.size(); ++row) {
+      if (validity && !validity->is_valid(row)) {
+        formatted.text += TBL_NULL_FIELD;
+      } else {
+        append_value(formatted.text, get_value(row), delimiter, nullable);
+      }
+      formatted.finish_field();
+    }
+  };
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    format_rows([&](const size_t row) -> const T& { return values[row]; });
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    // format each distinct value once and copy it for every row that refers to it
+    FormattedColumn dictionary;
+    const auto dictionary_size = dictionary_column->unique_values_count();
+    dictionary.offsets.reserve(dictionary_size + 2);
+    for (auto value_id = ValueID{0}; value_id < dictionary_size; ++value_id) {
+      append_value(dictionary.text, T(dictionary_column->value_by_value_id(value_id)), delimiter, nullable);
+      dictionary.finish_field();
+    }
+    dictionary.text += TBL_NULL_FIELD;
+    dictionary.finish_field();
+
+    // the NULL value id is the dictionary size, which refers to the "null" entry
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    for (size_t row = 0; row < column.size(); ++row) {
+      const auto value_id = attribute_vector.get(row);
+      formatted.text.append(dictionary.text, dictionary.offsets[value_id],
+                            dictionary.offsets[value_id + 1] - dictionary.offsets[value_id]);
+      formatted.finish_field();
+    }
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    format_rows([&](const size_t row) { return run_length_column->get(row); });
+  } else {
+    auto is_frame_of_reference = false;
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto for_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        format_rows([&](const size_t row) { return for_column->get(row); });
+        is_frame_of_reference = true;
+      }
+    }
+    Assert(is_frame_of_reference, "ExportCsv: Unsupported column type.");
+  }
+  return formatted;
+}
+
+// formats the rows of a chunk, one line per row
+std::string format_chunk(const Table& table, const Chunk& chunk, const char delimiter) {
+  std::vector<FormattedColumn> columns;
+  columns.reserve(chunk.col_count());
+  size_t text_size = 0;
+  for (auto column_id = ColumnID{0}; column_id < chunk.col_count(); ++column_id) {
+    auto column = chunk.get_column(column_id);
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      column = reference_column->materialize();
+    }
+
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.push_back(format_column<ColumnDataType>(*column, delimiter, table.column_is_nullable(column_id)));
+    });
+    text_size += columns.back().text.size();
+  }
+
+  // interleave the fields of all columns row by row
+  std::string text;
+  text.reserve(text_size + size_t{chunk.size()} * chunk.col_count());
+  for (size_t row = 0; row < chunk.size(); ++row) {
+    for (size_t column_index = 0; column_index < columns.size(); ++column_index) {
+      const auto& column = columns[column_index];
+      text.append(column.text, column.offsets[row], column.offsets[row + 1] - column.offsets[row]);
+      text += column_index + 1 < columns.size() ? delimiter : '\n';
+    }
+  }
+  return text;
+}
+
+}  // namespace
+
+ExportCsv::ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name,
+                     const char delimiter, const uint32_t num_threads)
+    : AbstractOperator(in),
+      _file_name(file_name),
+      _delimiter(delimiter),
+      _num_threads(std::max(num_threads, uint32_t{1})) {}
+
+const std::string& ExportCsv::file_name() const { return _file_name; }
+
+std::shared_ptr<const Table> ExportCsv::_on_execute() {
+  const auto table = _input_table_left();
+
+  std::ofstream file(_file_name, std::ios::binary | std::ios::trunc);
+  Assert(file.is_open(), "ExportCsv: Could not open file " + _file_name);
+
+  std::vector<std::string> column_types;
+  for (auto column_id = ColumnID{0}; column_id < table->col_count(); ++column_id) {
+    Assert(is_valid_field(table->column_name(column_id), _delimiter),
+           "ExportCsv: Column names must not contain the delimiter or line breaks.");
+    column_types.push_back(table->column_type(column_id));
+    if (table->column_is_nullable(column_id)) column_types.back() += TBL_NULLABLE_TYPE_SUFFIX;
+  }
+
+  // the header consists of a line of column names and a line of column types
+  std::string header;
+  for (const auto& fields : {table->column_names(), column_types}) {
+    for (size_t index = 0; index < fields.size(); ++index) {
+      header += fields[index];
+      header += index + 1 < fields.size() ? _delimiter : '\n';
+    }
+  }
+  file.write(header.data(), header.size());
+
+  // format batches of a few chunks per thread, and write each batch while the next one is formatted
+  const auto chunk_count = static_cast<size_t>(table->chunk_count());
+  const auto batch_size = size_t{_num_threads} * 2;
+  std::thread writer;
+  try {
+    for (size_t batch_begin = 0; batch_begin < chunk_count; batch_begin += batch_size) {
+      const auto batch_end = std::min(batch_begin + batch_size, chunk_count);
+      std::vector<std::string> texts(batch_end - batch_begin);
+      parallel_for(texts.size(), _num_threads, [&](size_t index) {
+        texts[index] = format_chunk(*table, table->get_chunk(ChunkID(batch_begin + index)), _delimiter);
+      });
+
+      if (writer.joinable()) writer.join();
+      writer = std::thread([&file, texts = std::move(texts)]() {
+        for (const auto& text : texts) file.write(text.data(), text.size());
+      });
+    }
+  } catch (...) {
+    if (writer.joinable()) writer.join();
+    throw;
+  }
+  if (writer.joinable()) writer.join();
+
+  file.close();
+  Assert(!file.fail(), "ExportCsv: Could not write file " + _file_name);
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Writes its input table to a text file in the .tbl format that TableFileReader and ImportCsv read: a line of column
+// names, a line of column types, and one line per row, with fields separated by the delimiter. Numbers are formatted
+// with std::to_chars, so floating-point values are written in their shortest representation that parses back exactly.
+// The types of nullable columns carry the suffix "_null", and their NULLs are written as "null", so that they are read
+// back as NULLs. Column names and strings must not contain the delimiter or line breaks, since fields are not quoted,
+// and the strings of nullable columns must not be "null".
+//
+// Chunks are formatted in parallel, column by column and without AllTypeVariants: ReferenceColumns are materialized
+// chunk by chunk, and the dictionary entries of DictionaryColumns are formatted only once per chunk. While one batch of
+// chunks is formatted, the previous batch is written to the file in order. The input table is passed on.
+class ExportCsv : public AbstractOperator {
+ public:
+  ExportCsv(const std::shared_ptr<const AbstractOperator> in, const std::string& file_name, char delimiter = '|',
+            uint32_t num_threads = std::thread::hardware_concurrency());
+
+  const std::string& file_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const char _delimiter;
+  const uint32_t _num_threads;
+};
+
+}  // namespace opossum
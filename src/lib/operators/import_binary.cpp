@@ -0,0 +1,23 @@
+#include "import_binary.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "storage/binary_table.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+ImportBinary::ImportBinary(const std::string& file_name, const std::optional<std::string>& table_name)
+    : _file_name(file_name), _table_name(table_name) {}
+
+const std::string& ImportBinary::file_name() const { return _file_name; }
+
+std::shared_ptr<const Table> ImportBinary::_on_execute() {
+  auto table = map_binary_table(_file_name);
+  if (_table_name) StorageManager::get().add_table(*_table_name, table);
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+// Loads a table from a file in the binary table format (see map_binary_table). The file is memory-mapped, and encoded
+// chunks are used in place. If a table name is given, the table is also added to the StorageManager.
+class ImportBinary : public AbstractOperator {
+ public:
+  explicit ImportBinary(const std::string& file_name, const std::optional<std::string>& table_name = std::nullopt);
+
+  const std::string& file_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const std::optional<std::string> _table_name;
+};
+
+}  // namespace opossum
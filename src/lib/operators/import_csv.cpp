@@ -0,0 +1,53 @@
+#include "import_csv.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/table_file_reader.hpp"
+
+namespace opossum {
+
+ImportCsv::ImportCsv(const std::string& file_name, const uint32_t chunk_size,
+                     const std::optional<std::string>& table_name, const std::optional<EncodingType> encoding_type,
+                     const char delimiter, const uint32_t num_threads)
+    : _file_name(file_name),
+      _chunk_size(chunk_size),
+      _table_name(table_name),
+      _encoding_type(encoding_type),
+      _delimiter(delimiter),
+      _num_threads(std::max(num_threads, uint32_t{1})) {}
+
+const std::string& ImportCsv::file_name() const { return _file_name; }
+
+std::shared_ptr<const Table> ImportCsv::_on_execute() {
+  auto reader = TableFileReader{_file_name, _delimiter};
+  auto table = reader.create_table(_chunk_size);
+
+  // The table is added to the StorageManager once it holds its first batch, so queries do not find it empty merely
+  // because the import has not parsed any rows yet.
+  auto is_published = !_table_name;
+  auto batch_begin = ChunkID{0};
+  while (reader.read_chunks(_chunk_size, _num_threads, _num_threads,
+                            [&](Chunk&& chunk) { table->emplace_chunk(std::move(chunk)); })) {
+    if (!is_published) {
+      StorageManager::get().add_table(*_table_name, table);
+      is_published = true;
+    }
+
+    // replacing the ValueColumns frees their memory unless a concurrent query still uses them
+    const auto batch_end = table->chunk_count();
+    if (_encoding_type) table->compress_chunks(batch_begin, batch_end, _num_threads, *_encoding_type);
+    batch_begin = batch_end;
+  }
+
+  // a file without rows
+  if (!is_published) StorageManager::get().add_table(*_table_name, table);
+  return table;
+}
+
+}  // namespace opossum
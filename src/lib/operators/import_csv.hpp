@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Loads a table from a .tbl or CSV file (see TableFileReader) in batches of num_threads chunks, which are parsed in
+// parallel. If a table name is given, the table is added to the StorageManager as soon as the first batch has been
+// parsed, and each later chunk is published once its batch has been parsed, so queries can use the loaded chunks while
+// the import is still running. If an encoding is given, the chunks of each batch are compressed before the next batch
+// is read. Besides the table itself, the import only holds the unencoded chunks of one batch in memory.
+// A chunk size of 0 loads the whole file into a single chunk.
+class ImportCsv : public AbstractOperator {
+ public:
+  ImportCsv(const std::string& file_name, uint32_t chunk_size,
+            const std::optional<std::string>& table_name = std::nullopt,
+            std::optional<EncodingType> encoding_type = std::nullopt, char delimiter = '|',
+            uint32_t num_threads = std::thread::hardware_concurrency());
+
+  const std::string& file_name() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::string _file_name;
+  const uint32_t _chunk_size;
+  const std::optional<std::string> _table_name;
+  const std::optional<EncodingType> _encoding_type;
+  const char _delimiter;
+  const uint32_t _num_threads;
+};
+
+}  // namespace opossum
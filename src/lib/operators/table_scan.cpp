@@ -0,0 +1,427 @@
+#include "table_scan.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/bloom_filter.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/index/b_plus_tree/b_plus_tree_index.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/compare_by_scan_type.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Converts a floating-point search value for an integral column into a search value of the column's type, adjusting the
+// scan type so that every row keeps its result, e.g., `< 3.5` becomes `<= 3`. Search values that no value of the
+// column can equal turn the scan into one that matches no row (`< min`) or all rows (`>= min`).
+template <typename T>
+std::pair<ScanType, AllTypeVariant> integral_scan(const ScanType scan_type, const double search_value) {
+  // all values of T lie in [-limit, limit), both bounds are exact as doubles
+  const auto limit = std::ldexp(1.0, std::numeric_limits<T>::digits);
+  const auto match_none = std::pair<ScanType, AllTypeVariant>{ScanType::OpLessThan, std::numeric_limits<T>::min()};
+  const auto match_all =
+      std::pair<ScanType, AllTypeVariant>{ScanType::OpGreaterThanEquals, std::numeric_limits<T>::min()};
+
+  if (std::isnan(search_value)) return scan_type == ScanType::OpNotEquals ? match_all : match_none;
+
+  const auto is_below = search_value < -limit;
+  const auto is_above = search_value >= limit;
+  if (!is_below && !is_above && std::floor(search_value) == search_value) {
+    return {scan_type, static_cast<T>(search_value)};
+  }
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return match_none;
+    case ScanType::OpNotEquals:
+      return match_all;
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+      if (is_below) return match_none;
+      if (is_above) return match_all;
+      return {ScanType::OpLessThanEquals, static_cast<T>(std::floor(search_value))};
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      if (is_below) return match_all;
+      if (is_above) return match_none;
+      return {ScanType::OpGreaterThanEquals, static_cast<T>(std::ceil(search_value))};
+  }
+  Fail("Unknown scan type.");
+  return match_none;
+}
+
+}  // namespace
+
+// Scans the chunks of a table for a column of one data type. The implementation is created once per scan with
+// make_unique_by_column_type, so that all loops over the values of a column are typed.
+class BaseTableScanImpl {
+ public:
+  virtual ~BaseTableScanImpl() = default;
+
+  // appends the positions of all matching rows of a chunk that holds actual data (i.e., no ReferenceColumns)
+  virtual void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& pos_list) const = 0;
+
+  // appends the positions of all matching rows of a ReferenceColumn, given as positions in the referenced table
+  virtual void scan_reference_column(const ReferenceColumn& column, PosList& pos_list) const = 0;
+};
+
+template <typename T>
+class TableScanImpl : public BaseTableScanImpl {
+ public:
+  TableScanImpl(const ColumnID column_id, const ScanType scan_type, const AllTypeVariant& search_value)
+      : _column_id(column_id),
+        _scan_type(scan_type),
+        _search_value(search_value),
+        _typed_search_value(type_cast<T>(search_value)),
+        _search_value_hash(bloom_filter_hash(_typed_search_value)) {}
+
+  void scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& pos_list) const override {
+    if (_is_excluded_by_bloom_filter(chunk, _column_id)) return;
+
+    const auto column = chunk.get_column(_column_id);
+
+    switch (column->match_zone_map(_scan_type, _search_value)) {
+      case ZoneMapMatch::None:
+        return;
+      case ZoneMapMatch::All:
+        // the column has no NULLs, so its ValidityBitmap does not have to be looked at
+        _emit_matches(0, column->size(), nullptr, chunk_id, pos_list, [](size_t) { return true; });
+        return;
+      case ZoneMapMatch::AllValid:
+        // zone maps only cover the valid values, NULLs never match
+        _emit_matches(0, column->size(), column->validity(), chunk_id, pos_list, [](size_t) { return true; });
+        return;
+      case ZoneMapMatch::Partial:
+        break;
+    }
+
+    // An index answers all predicates but OpNotEquals with one range of offsets, which is not worth it for the latter
+    // and would miss NaN rows, which OpNotEquals matches but indexes leave out.
+    // Indexes on value columns do not see rows appended after their creation, so those are only used while complete.
+    const auto index = chunk.get_index(_column_id);
+    const auto index_is_complete = index && index->row_count() == column->size();
+    if (index_is_complete && _scan_type != ScanType::OpNotEquals) {
+      _scan_index(*index, chunk_id, pos_list);
+    } else if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(column.get())) {
+      _scan_value_column(*value_column, chunk_id, pos_list);
+    } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(column.get())) {
+      _scan_dictionary_column(*dictionary_column, chunk_id, pos_list);
+    } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(column.get())) {
+      run_length_column->scan(_scan_type, _search_value, chunk_id, pos_list);
+    } else if (!_scan_frame_of_reference_column(*column, chunk_id, pos_list)) {
+      Fail("Unsupported column type in TableScan.");
+    }
+  }
+
+  void scan_reference_column(const ReferenceColumn& column, PosList& pos_list) const override {
+    const auto& referenced_table = *column.referenced_table();
+
+    // the referenced column, its zone map result, and its typed representation are looked up once per chunk
+    std::optional<ChunkID> current_chunk_id;
+    std::shared_ptr<BaseColumn> referenced_column;
+    const ValidityBitmap* validity = nullptr;
+    auto zone_map_match = ZoneMapMatch::Partial;
+    const ValueColumn<T>* value_column = nullptr;
+    const DictionaryColumn<T>* dictionary_column = nullptr;
+
+    for (const auto& row_id : *column.pos_list()) {
+      if (!current_chunk_id || row_id.chunk_id != *current_chunk_id) {
+        current_chunk_id = row_id.chunk_id;
+        const auto& referenced_chunk = referenced_table.get_chunk(row_id.chunk_id);
+        referenced_column = referenced_chunk.get_column(column.referenced_column_id());
+        validity = referenced_column->validity();
+        zone_map_match = _is_excluded_by_bloom_filter(referenced_chunk, column.referenced_column_id())
+                             ? ZoneMapMatch::None
+                             : referenced_column->match_zone_map(_scan_type, _search_value);
+        value_column = dynamic_cast<const ValueColumn<T>*>(referenced_column.get());
+        dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(referenced_column.get());
+      }
+
+      if (zone_map_match == ZoneMapMatch::None) continue;
+      if (zone_map_match != ZoneMapMatch::All && validity && !validity->is_valid(row_id.chunk_offset)) continue;
+      if (zone_map_match == ZoneMapMatch::All || zone_map_match == ZoneMapMatch::AllValid) {
+        pos_list.push_back(row_id);
+        continue;
+      }
+
+      const T value = value_column ? value_column->values()[row_id.chunk_offset]
+                                   : dictionary_column ? dictionary_column->get(row_id.chunk_offset)
+                                                       : type_cast<T>((*referenced_column)[row_id.chunk_offset]);
+      if (compare_by_scan_type(_scan_type, value, _typed_search_value)) pos_list.push_back(row_id);
+    }
+  }
+
+ protected:
+  // returns true if the chunk has a Bloom filter for the given column which rules out the search value
+  bool _is_excluded_by_bloom_filter(const Chunk& chunk, const ColumnID column_id) const {
+    if (_scan_type != ScanType::OpEquals) return false;
+    const auto bloom_filter = chunk.get_bloom_filter(column_id);
+    return bloom_filter && !bloom_filter->may_contain(_search_value_hash);
+  }
+
+  // the matching rows are appended in the order of their values, not in the order of their offsets
+  void _scan_index(const BaseIndex& index, const ChunkID chunk_id, PosList& pos_list) const {
+    // NaN rows are left out of the index, and comparisons with a NaN search value only hold for OpNotEquals
+    if constexpr (std::is_floating_point<T>::value) {
+      if (std::isnan(_typed_search_value)) return;
+    }
+
+    auto begin = index.cbegin();
+    auto end = index.cend();
+
+    // the scanned column is the first column of the index, so the bounds of a one-value prefix are used
+    const auto search_values = std::vector<AllTypeVariant>{_search_value};
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+        begin = index.lower_bound(search_values);
+        end = index.upper_bound(search_values);
+        break;
+      case ScanType::OpLessThan:
+        end = index.lower_bound(search_values);
+        break;
+      case ScanType::OpLessThanEquals:
+        end = index.upper_bound(search_values);
+        break;
+      case ScanType::OpGreaterThan:
+        begin = index.upper_bound(search_values);
+        break;
+      case ScanType::OpGreaterThanEquals:
+        begin = index.lower_bound(search_values);
+        break;
+      case ScanType::OpNotEquals:
+        Fail("OpNotEquals cannot be answered with a single range of the index.");
+    }
+
+    pos_list.reserve(pos_list.size() + std::distance(begin, end));
+    for (auto it = begin; it != end; ++it) {
+      pos_list.push_back(RowID{chunk_id, *it});
+    }
+  }
+
+  // Appends the rows in [begin, end) for which predicate(offset) holds and which are not NULL. For nullable columns,
+  // the results of 64 rows are collected in one word, which is combined with the validity bitmap by a single AND.
+  // `begin` has to be a multiple of 64.
+  template <typename Predicate>
+  static void _emit_matches(const size_t begin, const size_t end, const ValidityBitmap* validity,
+                            const ChunkID chunk_id, PosList& pos_list, const Predicate& predicate) {
+    if (!validity) {
+      for (auto chunk_offset = static_cast<ChunkOffset>(begin); chunk_offset < end; ++chunk_offset) {
+        if (predicate(chunk_offset)) pos_list.push_back(RowID{chunk_id, chunk_offset});
+      }
+      return;
+    }
+
+    DebugAssert(begin % 64 == 0, "Range has to start at a word of the validity bitmap.");
+    for (auto word_begin = begin; word_begin < end; word_begin += 64) {
+      const auto word_end = std::min(word_begin + 64, end);
+      auto matches = uint64_t{0};
+      for (auto offset = word_begin; offset < word_end; ++offset) {
+        matches |= static_cast<uint64_t>(predicate(offset)) << (offset - word_begin);
+      }
+      ValidityBitmap::for_each_set_bit(matches & validity->word(word_begin / 64), word_begin, [&](const size_t offset) {
+        pos_list.push_back(RowID{chunk_id, static_cast<ChunkOffset>(offset)});
+      });
+    }
+  }
+
+  void _scan_value_column(const ValueColumn<T>& column, const ChunkID chunk_id, PosList& pos_list) const {
+    const auto& values = column.values();
+    resolve_scan_type_comparator(_scan_type, [&](auto comparator) {
+      _emit_matches(0, values.size(), column.validity(), chunk_id, pos_list,
+                    [&](const size_t offset) { return comparator(values[offset], _typed_search_value); });
+    });
+  }
+
+  // The predicate on values is translated into a predicate on value ids, so that the attribute vector can be scanned
+  // without looking at the dictionary. Since the dictionary is sorted, e.g., `value <= x` holds exactly for the value
+  // ids below upper_bound(x). INVALID_VALUE_ID is larger than all value ids, which covers values that are not found.
+  // The NULL value id is larger than all other value ids, so NULLs only have to be removed for (not-)greater and
+  // not-equals predicates, which happens through the validity bitmap. The NaN value id comes right before it and is
+  // cut off for greater predicates, while a NaN search value only matches OpNotEquals.
+  void _scan_dictionary_column(const DictionaryColumn<T>& column, const ChunkID chunk_id, PosList& pos_list) const {
+    if constexpr (std::is_floating_point<T>::value) {
+      if (std::isnan(_typed_search_value) && _scan_type != ScanType::OpNotEquals) return;
+    }
+
+    auto value_id_scan_type = _scan_type;
+    auto search_value_id = INVALID_VALUE_ID;
+    auto end_value_id = INVALID_VALUE_ID;
+
+    switch (_scan_type) {
+      case ScanType::OpEquals:
+      case ScanType::OpNotEquals: {
+        const auto lower_bound = column.lower_bound(_typed_search_value);
+        if (lower_bound != INVALID_VALUE_ID && column.value_by_value_id(lower_bound) == _typed_search_value) {
+          search_value_id = lower_bound;
+        }
+        break;
+      }
+      case ScanType::OpLessThan:
+        search_value_id = column.lower_bound(_typed_search_value);
+        break;
+      case ScanType::OpGreaterThanEquals:
+        search_value_id = column.lower_bound(_typed_search_value);
+        end_value_id = column.nan_value_id();
+        break;
+      case ScanType::OpLessThanEquals:
+        value_id_scan_type = ScanType::OpLessThan;
+        search_value_id = column.upper_bound(_typed_search_value);
+        break;
+      case ScanType::OpGreaterThan:
+        value_id_scan_type = ScanType::OpGreaterThanEquals;
+        search_value_id = column.upper_bound(_typed_search_value);
+        end_value_id = column.nan_value_id();
+        break;
+    }
+
+    // Value ids are decoded in batches, which allows BitPackedAttributeVectors to unpack whole blocks at once. The
+    // batch size is a multiple of 64, so each batch starts at a word of the validity bitmap.
+    constexpr size_t batch_size = 1024;
+    const auto& attribute_vector = *column.attribute_vector();
+    const auto validity = column.validity();
+    std::vector<ValueID> value_ids(batch_size);
+
+    resolve_scan_type_comparator(value_id_scan_type, [&](auto comparator) {
+      for (size_t begin = 0; begin < attribute_vector.size(); begin += batch_size) {
+        const auto count = std::min(batch_size, attribute_vector.size() - begin);
+        attribute_vector.get_range(begin, count, value_ids.data());
+        _emit_matches(begin, begin + count, validity, chunk_id, pos_list, [&](const size_t offset) {
+          const auto value_id = value_ids[offset - begin];
+          return comparator(value_id.t, search_value_id.t) && value_id < end_value_id;
+        });
+      }
+    });
+  }
+
+  // returns false if the column is not a FrameOfReferenceColumn, which only exists for integral types
+  bool _scan_frame_of_reference_column(const BaseColumn& column, const ChunkID chunk_id, PosList& pos_list) const {
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        frame_of_reference_column->scan(_scan_type, _search_value, chunk_id, pos_list);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
+  const T _typed_search_value;
+  const uint64_t _search_value_hash;
+};
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
+                     const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
+
+TableScan::~TableScan() = default;
+
+ColumnID TableScan::column_id() const { return _column_id; }
+
+ScanType TableScan::scan_type() const { return _scan_type; }
+
+const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  // All scan paths compare values of the column's type. A floating-point search value for an integral column is
+  // converted so that it is not truncated, e.g., `< 3.5` must still match 3.
+  auto scan_type = _scan_type;
+  auto search_value = _search_value;
+  resolve_data_type(input_table->column_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if constexpr (std::is_integral<ColumnDataType>::value) {
+      if (search_value.type() == typeid(float) || search_value.type() == typeid(double)) {
+        std::tie(scan_type, search_value) = integral_scan<ColumnDataType>(scan_type, type_cast<double>(search_value));
+      }
+    }
+  });
+
+  // as in SQL, no comparison with NULL holds, so a NULL search value does not match any row
+  const auto search_value_is_null = variant_is_null(search_value);
+  const auto impl = search_value_is_null
+                        ? nullptr
+                        : make_unique_by_column_type<BaseTableScanImpl, TableScanImpl>(
+                              input_table->column_type(_column_id), _column_id, scan_type, search_value);
+
+  // If the input is the result of another scan, its ReferenceColumns all share the same referenced table. The output
+  // references this table directly instead of adding another level of indirection.
+  auto referenced_table = input_table;
+  std::vector<ColumnID> referenced_column_ids;
+  const auto& first_chunk = input_table->get_chunk(ChunkID{0});
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    const auto column = first_chunk.col_count() > 0 ? first_chunk.get_column(column_id) : nullptr;
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      referenced_table = reference_column->referenced_table();
+      referenced_column_ids.push_back(reference_column->referenced_column_id());
+    } else {
+      referenced_column_ids.push_back(column_id);
+    }
+  }
+
+  // A table index on the scanned column answers the scan without visiting the chunks. Rows of chunks emplaced by
+  // concurrent writers may not be indexed yet, in which case the chunks are scanned as usual. Like chunk indexes, it
+  // is not used for OpNotEquals, which matches NaN rows that the index leaves out.
+  const auto table_index = referenced_table == input_table ? input_table->get_table_index(_column_id) : nullptr;
+  const auto use_table_index = impl && table_index && scan_type != ScanType::OpNotEquals &&
+                               table_index->size() == input_table->row_count();
+
+  // The matches of each chunk are collected in the arena for intermediate results, where only the PosList of that
+  // chunk grows. They are concatenated once into the PosList of the output, which is allocated at its final size.
+  std::pmr::vector<PosList> chunk_matches(_memory_resource());
+  if (use_table_index) table_index->scan(scan_type, {search_value}, chunk_matches.emplace_back());
+  for (ChunkID chunk_id{0}; impl && !use_table_index && chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    auto& matches = chunk_matches.emplace_back();
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(chunk.get_column(_column_id))) {
+      DebugAssert(reference_column->referenced_table() == referenced_table,
+                  "All ReferenceColumns of the input have to reference the same table.");
+      impl->scan_reference_column(*reference_column, matches);
+    } else {
+      DebugAssert(referenced_table == input_table, "Input mixes ReferenceColumns with other columns.");
+      impl->scan_chunk(chunk, chunk_id, matches);
+    }
+  }
+
+  // the PosList is shared by all ReferenceColumns of the output
+  auto match_count = size_t{0};
+  for (const auto& matches : chunk_matches) match_count += matches.size();
+  const auto pos_list = _make_pos_list(match_count);
+  for (const auto& matches : chunk_matches) pos_list->insert(pos_list->end(), matches.begin(), matches.end());
+  auto output = std::make_shared<Table>();
+  Chunk chunk;
+  for (ColumnID column_id{0}; column_id < input_table->col_count(); ++column_id) {
+    output->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id),
+                                  input_table->column_is_nullable(column_id));
+    chunk.add_column(std::make_shared<ReferenceColumn>(referenced_table, referenced_column_ids[column_id], pos_list));
+  }
+  output->emplace_chunk(std::move(chunk));
+
+  return output;
+}
+
+}  // namespace opossum
@@ -15,6 +15,12 @@ namespace opossum {
 class BaseTableScanImpl;
 class Table;
 
+// TableScan returns all rows of its input for which `value <scan_type> search_value` holds for the given column.
+// The result consists of ReferenceColumns that point to the table holding the actual data, also when the input itself
+// is the result of a scan. Chunks are pruned using the zone maps of their columns: chunks in which no value can match
+// are skipped and chunks in which all values match are emitted as a whole, without looking at the values.
+// The search value is converted to the type of the column. For integral columns, a floating-point search value is not
+// truncated, but the comparison is adjusted, e.g., `< 3.5` matches 3 and `= 3.5` matches no row.
 class TableScan : public AbstractOperator {
  public:
   TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
@@ -28,6 +34,10 @@ class TableScan : public AbstractOperator {
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const ScanType _scan_type;
+  const AllTypeVariant _search_value;
 };
 
 }  // namespace opossum
@@ -129,4 +129,17 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Returns the string representation of a column type, e.g., "int" for int32_t
+ */
+template <typename T>
+std::string type_string_of() {
+  std::string type_string;
+  hana::for_each(column_types, [&](auto x) {
+    if (hana::second(x) == hana::type_c<T>) type_string = hana::first(x);
+  });
+  DebugAssert(!type_string.empty(), "Type is not a column type");
+  return type_string;
+}
+
 }  // namespace opossum
@@ -0,0 +1,68 @@
+#include "background_compressor.hpp"
+
+#include <exception>
+#include <mutex>
+
+#include "table.hpp"
+
+namespace opossum {
+
+BackgroundCompressor::BackgroundCompressor(Table& table, const EncodingType encoding_type)
+    : _table(table), _encoding_type(encoding_type), _thread(&BackgroundCompressor::_run, this) {}
+
+BackgroundCompressor::~BackgroundCompressor() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _queue_changed.notify_all();
+  _thread.join();
+}
+
+void BackgroundCompressor::enqueue(const ChunkID chunk_id) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _queue.push_back(chunk_id);
+  }
+  _queue_changed.notify_all();
+}
+
+void BackgroundCompressor::wait_until_idle() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _queue_changed.wait(lock, [&]() { return _queue.empty() && !_is_compressing; });
+
+  if (_exception) {
+    auto exception = _exception;
+    _exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void BackgroundCompressor::_run() {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  while (true) {
+    _queue_changed.wait(lock, [&]() { return _stop || !_queue.empty(); });
+    if (_stop) return;
+
+    const auto chunk_id = _queue.front();
+    _queue.pop_front();
+    _is_compressing = true;
+
+    // compress without holding the lock so that the writer can keep queueing chunks
+    lock.unlock();
+    std::exception_ptr exception;
+    try {
+      _table.compress_chunk(chunk_id, _encoding_type);
+    } catch (...) {
+      exception = std::current_exception();
+    }
+    lock.lock();
+
+    if (exception && !_exception) _exception = exception;
+    _is_compressing = false;
+    _queue_changed.notify_all();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// BackgroundCompressor owns a thread that compresses the chunks of a table one after another, in the order in which
+// they were queued. It is used by Table::enable_background_compression, see there.
+class BackgroundCompressor : private Noncopyable {
+ public:
+  BackgroundCompressor(Table& table, const EncodingType encoding_type);
+
+  // compresses the chunk that is currently being worked on and drops all chunks that are still queued
+  ~BackgroundCompressor();
+
+  // queues a chunk for compression, the chunk must not be modified anymore
+  void enqueue(const ChunkID chunk_id);
+
+  // blocks until all queued chunks have been compressed
+  // rethrows the first exception that occurred while compressing a chunk, if any
+  void wait_until_idle();
+
+ protected:
+  void _run();
+
+  Table& _table;
+  const EncodingType _encoding_type;
+
+  std::mutex _mutex;
+  std::condition_variable _queue_changed;
+  std::deque<ChunkID> _queue;
+  bool _is_compressing = false;
+  bool _stop = false;
+  std::exception_ptr _exception;
+
+  // declared last so that all members above are initialized before the thread starts
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -5,7 +5,7 @@
 namespace opossum {
 
 // BaseAttributeVector is the abstract super class for all attribute vectors,
-// e.g., FittedAttributeVector
+// e.g., FittedAttributeVector, BitPackedAttributeVector
 class BaseAttributeVector : private Noncopyable {
  public:
   BaseAttributeVector() = default;
@@ -22,10 +22,17 @@ class BaseAttributeVector : private Noncopyable {
   // sets the value_id at a given position
   virtual void set(const size_t i, const ValueID value_id) = 0;
 
+  // writes the value ids at positions [begin, begin + count) to out, which must have space for count values
+  // prefer this over repeated calls to get() when decoding many values
+  virtual void get_range(const size_t begin, const size_t count, ValueID* out) const = 0;
+
   // returns the number of values
   virtual size_t size() const = 0;
 
   // returns the width of the values in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // returns the estimated number of bytes used by the attribute vector, including its values
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
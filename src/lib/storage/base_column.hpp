@@ -5,6 +5,8 @@
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
+#include "validity_bitmap.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
@@ -28,5 +30,28 @@ class BaseColumn : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // Returns the estimated number of bytes used by the column, i.e., the column object and everything it owns on the
+  // heap, e.g., value vectors, dictionaries, attribute vectors, and the payload of long strings. Data shared with
+  // other columns (the PosList of ReferenceColumns) is counted for each of them.
+  virtual size_t estimate_memory_usage() const = 0;
+
+  // returns the name of the encoding of the column, e.g., "Dictionary", by which memory usage is broken down
+  virtual std::string encoding_name() const = 0;
+
+  // checks the zone map of the column for the predicate `value <scan_type> search_value`, see zone_map.hpp
+  // columns without a zone map return ZoneMapMatch::Partial, i.e., every value has to be checked
+  virtual ZoneMapMatch match_zone_map(const ScanType, const AllTypeVariant&) const { return ZoneMapMatch::Partial; }
+
+  // Returns the bitmap that marks the rows of a nullable column that are not NULL, or nullptr if the column cannot
+  // contain NULLs. Encoded columns keep the bitmap of the column they were created from. ReferenceColumns do not store
+  // values themselves and return nullptr, their operator[] returns NULL_VALUE for NULLs of the referenced column.
+  virtual const ValidityBitmap* validity() const { return nullptr; }
+
+  // returns whether the value at a given position is NULL
+  bool is_null(const size_t i) const {
+    const auto validity_bitmap = validity();
+    return validity_bitmap && !validity_bitmap->is_valid(i);
+  }
 };
 }  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseAttributeVector;
+
+// BaseDictionaryColumn is the type-independent interface of DictionaryColumn<T>. It allows, e.g., indexes to work on
+// value ids without knowing the data type of the column.
+class BaseDictionaryColumn : public BaseColumn {
+ public:
+  // returns the first value ID that refers to a value >= the search value
+  // returns INVALID_VALUE_ID if all values are smaller than the search value
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // returns the first value ID that refers to a value > the search value
+  // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // return the number of unique_values (dictionary entries)
+  virtual size_t unique_values_count() const = 0;
+
+  // returns the value id of NULL rows, which is unique_values_count()
+  virtual ValueID null_value_id() const = 0;
+
+  // returns the value id of NaN rows, which comes after all ordered values, or null_value_id() if there are none
+  virtual ValueID nan_value_id() const = 0;
+
+  // returns an underlying data structure
+  virtual std::shared_ptr<const BaseAttributeVector> attribute_vector() const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,490 @@
+#include "binary_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "fitted_attribute_vector.hpp"
+#include "frame_of_reference_column.hpp"
+#include "reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr char MAGIC[sizeof(uint64_t)] = {'O', 'P', 'S', 'M', 'T', 'B', 'L', '\0'};
+constexpr uint32_t FORMAT_VERSION = 2;
+// reads as a different number on machines with another byte order
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+// arrays start at multiples of a cache line, which also satisfies the alignment of all value types
+constexpr size_t ARRAY_ALIGNMENT = 64;
+constexpr size_t WRITE_BUFFER_SIZE = size_t{4} << 20;
+
+enum class ColumnEncoding : uint8_t { Unencoded, Dictionary, RunLength, FrameOfReference };
+enum class AttributeVectorKind : uint8_t { Fitted, BitPacked };
+
+// the offsets of concatenated strings start at 0, never decrease, and end at the number of characters
+template <typename Offsets>
+bool are_valid_string_offsets(const Offsets& offsets, const size_t character_count) {
+  if (offsets.empty() || offsets.front() != 0 || offsets.back() != character_count) return false;
+  return std::is_sorted(offsets.begin(), offsets.end());
+}
+
+class BinaryWriter {
+ public:
+  explicit BinaryWriter(const std::string& file_name) : _buffer(WRITE_BUFFER_SIZE) {
+    // the buffer has to be set before the file is opened
+    _file.rdbuf()->pubsetbuf(_buffer.data(), _buffer.size());
+    _file.open(file_name, std::ios::binary | std::ios::trunc);
+    Assert(_file.is_open(), "write_binary_table: Could not open file " + file_name);
+  }
+
+  template <typename T>
+  void write(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written directly.");
+    _write_bytes(&value, sizeof(T));
+  }
+
+  void write_string(const std::string_view string) {
+    write(static_cast<uint32_t>(string.size()));
+    _write_bytes(string.data(), string.size());
+  }
+
+  template <typename T>
+  void write_array(const T* values, const size_t count) {
+    write(static_cast<uint64_t>(count));
+    _align();
+    _write_bytes(values, count * sizeof(T));
+  }
+
+  // writes the offsets of the strings into their concatenation, followed by the concatenation itself
+  template <typename Strings>
+  void write_strings(const Strings& strings) {
+    std::vector<uint64_t> offsets;
+    offsets.reserve(strings.size() + 1);
+    offsets.push_back(0);
+    for (const auto& string : strings) offsets.push_back(offsets.back() + string.size());
+    write_array(offsets.data(), offsets.size());
+
+    write(offsets.back());
+    _align();
+    for (const auto& string : strings) _write_bytes(string.data(), string.size());
+  }
+
+  void finish() {
+    _file.flush();
+    Assert(_file.good(), "write_binary_table: Could not write file.");
+  }
+
+ protected:
+  void _write_bytes(const void* bytes, const size_t count) {
+    _file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(count));
+    _position += count;
+  }
+
+  void _align() {
+    static constexpr char zeros[ARRAY_ALIGNMENT] = {};
+    _write_bytes(zeros, (ARRAY_ALIGNMENT - _position % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT);
+  }
+
+  // declared before the file, so that it outlives the file's final flush
+  std::vector<char> _buffer;
+  std::ofstream _file;
+  size_t _position = 0;
+};
+
+class BinaryReader {
+ public:
+  explicit BinaryReader(std::shared_ptr<const MappedFile> file) : _file(std::move(file)) {}
+
+  template <typename T>
+  T read() {
+    _check_remaining(1, sizeof(T));
+    T value;
+    std::memcpy(&value, _file->data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto size = read<uint32_t>();
+    _check_remaining(size, 1);
+    std::string string(_file->data() + _position, size);
+    _position += size;
+    return string;
+  }
+
+  // returns a buffer that refers to the array in the mapped file
+  template <typename T>
+  ColumnBuffer<T> read_array() {
+    const auto count = read<uint64_t>();
+    _position += (ARRAY_ALIGNMENT - _position % ARRAY_ALIGNMENT) % ARRAY_ALIGNMENT;
+    _check_remaining(count, sizeof(T));
+    const auto values = reinterpret_cast<const T*>(_file->data() + _position);
+    _position += count * sizeof(T);
+    return ColumnBuffer<T>(values, count, _file);
+  }
+
+  template <typename T>
+  std::vector<T> read_vector() {
+    const auto array = read_array<T>();
+    return std::vector<T>(array.begin(), array.end());
+  }
+
+  std::vector<std::string> read_strings() {
+    const auto offsets = read_array<uint64_t>();
+    const auto characters = read_array<char>();
+    Assert(are_valid_string_offsets(offsets, characters.size()), "Binary table file contains invalid strings.");
+
+    std::vector<std::string> strings;
+    strings.reserve(offsets.size() - 1);
+    for (size_t index = 0; index + 1 < offsets.size(); ++index) {
+      strings.emplace_back(characters.data() + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+    return strings;
+  }
+
+ protected:
+  void _check_remaining(const size_t count, const size_t element_size) const {
+    if (_position > _file->size() || count > (_file->size() - _position) / element_size) {
+      throw std::logic_error("Binary table file is truncated.");
+    }
+  }
+
+  const std::shared_ptr<const MappedFile> _file;
+  size_t _position = 0;
+};
+
+template <typename T>
+void write_values(BinaryWriter& writer, const std::vector<T>& values) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    writer.write_strings(values);
+  } else {
+    writer.write_array(values.data(), values.size());
+  }
+}
+
+template <typename T>
+std::vector<T> read_values(BinaryReader& reader) {
+  if constexpr (std::is_same<T, std::string>::value) {
+    return reader.read_strings();
+  } else {
+    return reader.read_vector<T>();
+  }
+}
+
+template <typename T>
+void write_zone_map(BinaryWriter& writer, const ZoneMap<T>& zone_map) {
+  writer.write(static_cast<uint8_t>(zone_map.is_empty()));
+  writer.write(static_cast<uint8_t>(zone_map.has_nan()));
+  if (zone_map.is_empty()) return;
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    writer.write_string(zone_map.min());
+    writer.write_string(zone_map.max());
+  } else {
+    writer.write(zone_map.min());
+    writer.write(zone_map.max());
+  }
+}
+
+template <typename T>
+ZoneMap<T> read_zone_map(BinaryReader& reader) {
+  ZoneMap<T> zone_map;
+  const auto is_empty = reader.read<uint8_t>();
+  if (reader.read<uint8_t>()) {
+    if constexpr (std::is_floating_point<T>::value) {
+      zone_map.add(std::numeric_limits<T>::quiet_NaN());
+    } else {
+      Fail("Binary table file contains a NaN in a column that is not floating-point.");
+    }
+  }
+  if (is_empty) return zone_map;
+
+  if constexpr (std::is_same<T, std::string>::value) {
+    zone_map.add(reader.read_string());
+    zone_map.add(reader.read_string());
+  } else {
+    zone_map.add(reader.read<T>());
+    zone_map.add(reader.read<T>());
+  }
+  return zone_map;
+}
+
+void write_validity(BinaryWriter& writer, const ValidityBitmap* validity) {
+  writer.write(static_cast<uint8_t>(validity != nullptr));
+  if (!validity) return;
+
+  writer.write(static_cast<uint64_t>(validity->size()));
+  writer.write_array(validity->words().data(), validity->words().size());
+}
+
+std::optional<ValidityBitmap> read_validity(BinaryReader& reader) {
+  if (!reader.read<uint8_t>()) return std::nullopt;
+
+  const auto size = reader.read<uint64_t>();
+  return ValidityBitmap(reader.read_vector<uint64_t>(), size);
+}
+
+void write_attribute_vector(BinaryWriter& writer, const BaseAttributeVector& attribute_vector) {
+  if (const auto bit_packed = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    writer.write(AttributeVectorKind::BitPacked);
+    writer.write(bit_packed->bit_width());
+    writer.write(static_cast<uint64_t>(bit_packed->size()));
+    writer.write_array(bit_packed->words().data(), bit_packed->words().size());
+    return;
+  }
+
+  writer.write(AttributeVectorKind::Fitted);
+  writer.write(attribute_vector.width());
+  const auto write_fitted = [&](auto width_type) {
+    using WidthType = decltype(width_type);
+    const auto& data = dynamic_cast<const FittedAttributeVector<WidthType>&>(attribute_vector).data();
+    writer.write_array(data.data(), data.size());
+  };
+
+  switch (attribute_vector.width()) {
+    case 1:
+      write_fitted(uint8_t{});
+      break;
+    case 2:
+      write_fitted(uint16_t{});
+      break;
+    case 4:
+      write_fitted(uint32_t{});
+      break;
+    default:
+      Fail("Unsupported attribute vector width.");
+  }
+}
+
+std::shared_ptr<BaseAttributeVector> read_attribute_vector(BinaryReader& reader) {
+  const auto kind = reader.read<AttributeVectorKind>();
+  if (kind == AttributeVectorKind::BitPacked) {
+    const auto bit_width = reader.read<uint8_t>();
+    const auto size = reader.read<uint64_t>();
+    return std::make_shared<BitPackedAttributeVector>(size, bit_width, reader.read_array<uint64_t>());
+  }
+
+  Assert(kind == AttributeVectorKind::Fitted, "Binary table file contains an unknown attribute vector.");
+  switch (reader.read<AttributeVectorWidth>()) {
+    case 1:
+      return std::make_shared<FittedAttributeVector<uint8_t>>(reader.read_array<uint8_t>());
+    case 2:
+      return std::make_shared<FittedAttributeVector<uint16_t>>(reader.read_array<uint16_t>());
+    case 4:
+      return std::make_shared<FittedAttributeVector<uint32_t>>(reader.read_array<uint32_t>());
+    default:
+      Fail("Binary table file contains an unsupported attribute vector width.");
+  }
+  return nullptr;
+}
+
+// a value id past the NULL value id, which follows the last dictionary entry, would be read outside the dictionary
+void check_value_ids(const BaseAttributeVector& attribute_vector, const size_t dictionary_size) {
+  constexpr size_t BATCH_SIZE = 1024;
+  ValueID value_ids[BATCH_SIZE];
+  for (size_t begin = 0; begin < attribute_vector.size(); begin += BATCH_SIZE) {
+    const auto count = std::min(BATCH_SIZE, attribute_vector.size() - begin);
+    attribute_vector.get_range(begin, count, value_ids);
+    const auto max_value_id = *std::max_element(value_ids, value_ids + count);
+    if (max_value_id > dictionary_size) Fail("Binary table file contains a value id outside of the dictionary.");
+  }
+}
+
+// runs that end before they start would make the column emit the same rows several times, or rows past its end
+void check_run_ends(const std::vector<ChunkOffset>& end_positions, const size_t value_count) {
+  Assert(end_positions.size() == value_count, "Binary table file contains runs without a value or an end position.");
+  auto previous_end = ChunkOffset{0};
+  for (const auto end : end_positions) {
+    if (end <= previous_end) Fail("Binary table file contains run ends that are not strictly increasing.");
+    previous_end = end;
+  }
+}
+
+template <typename T>
+void write_column(BinaryWriter& writer, const BaseColumn& column) {
+  if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&column)) {
+    // the values are materialized one column at a time, so only a single column is held in memory in addition
+    write_column<T>(writer, *reference_column->materialize());
+    return;
+  }
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    writer.write(ColumnEncoding::Unencoded);
+    write_values(writer, value_column->values());
+  } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    writer.write(ColumnEncoding::Dictionary);
+    const auto& dictionary = *dictionary_column->dictionary();
+    if constexpr (std::is_same<T, std::string>::value) {
+      writer.write_array(dictionary.offsets().data(), dictionary.offsets().size());
+      writer.write_array(dictionary.data().data(), dictionary.data().size());
+    } else {
+      writer.write_array(dictionary.data(), dictionary.size());
+    }
+    write_attribute_vector(writer, *dictionary_column->attribute_vector());
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    writer.write(ColumnEncoding::RunLength);
+    write_zone_map(writer, run_length_column->zone_map());
+    write_values(writer, run_length_column->values());
+    const auto& end_positions = run_length_column->end_positions();
+    writer.write_array(end_positions.data(), end_positions.size());
+  } else {
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        writer.write(ColumnEncoding::FrameOfReference);
+        write_zone_map(writer, frame_of_reference_column->zone_map());
+        const auto& block_minima = frame_of_reference_column->block_minima();
+        writer.write_array(block_minima.data(), block_minima.size());
+        const auto& offsets = *frame_of_reference_column->offsets();
+        writer.write(offsets.bit_width());
+        writer.write(static_cast<uint64_t>(offsets.size()));
+        writer.write_array(offsets.words().data(), offsets.words().size());
+        write_validity(writer, column.validity());
+        return;
+      }
+    }
+    Fail("write_binary_table: Unsupported column type.");
+  }
+
+  write_validity(writer, column.validity());
+}
+
+template <typename T>
+std::shared_ptr<BaseColumn> read_column(BinaryReader& reader) {
+  const auto encoding = reader.read<ColumnEncoding>();
+  switch (encoding) {
+    case ColumnEncoding::Unencoded: {
+      auto values = read_values<T>(reader);
+      return std::make_shared<ValueColumn<T>>(std::move(values), read_validity(reader));
+    }
+    case ColumnEncoding::Dictionary: {
+      std::shared_ptr<typename DictionaryColumn<T>::Dictionary> dictionary;
+      if constexpr (std::is_same<T, std::string>::value) {
+        auto offsets = reader.read_array<uint32_t>();
+        auto characters = reader.read_array<char>();
+        Assert(are_valid_string_offsets(offsets, characters.size()), "Binary table file contains invalid strings.");
+        dictionary = std::make_shared<StringDictionary>(std::move(characters), std::move(offsets));
+      } else {
+        dictionary = std::make_shared<ColumnBuffer<T>>(reader.read_array<T>());
+      }
+      auto attribute_vector = read_attribute_vector(reader);
+      check_value_ids(*attribute_vector, dictionary->size());
+      return std::make_shared<DictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector),
+                                                   read_validity(reader));
+    }
+    case ColumnEncoding::RunLength: {
+      const auto zone_map = read_zone_map<T>(reader);
+      auto values = read_values<T>(reader);
+      auto end_positions = reader.read_vector<ChunkOffset>();
+      check_run_ends(end_positions, values.size());
+      return std::make_shared<RunLengthColumn<T>>(std::move(values), std::move(end_positions), zone_map,
+                                                  read_validity(reader));
+    }
+    case ColumnEncoding::FrameOfReference: {
+      if constexpr (std::is_integral<T>::value) {
+        const auto zone_map = read_zone_map<T>(reader);
+        auto block_minima = reader.read_vector<T>();
+        const auto bit_width = reader.read<uint8_t>();
+        const auto size = reader.read<uint64_t>();
+        auto offsets = std::make_shared<BitPackedAttributeVector>(size, bit_width, reader.read_array<uint64_t>());
+        return std::make_shared<FrameOfReferenceColumn<T>>(std::move(block_minima), std::move(offsets), zone_map,
+                                                           read_validity(reader));
+      }
+      break;
+    }
+  }
+  Fail("Binary table file contains an unsupported column encoding.");
+  return nullptr;
+}
+
+}  // namespace
+
+void write_binary_table(const Table& table, const std::string& file_name) {
+  BinaryWriter writer(file_name);
+  writer.write(MAGIC);
+  writer.write(FORMAT_VERSION);
+  writer.write(BYTE_ORDER_MARK);
+  writer.write(table.chunk_size());
+  writer.write(table.col_count());
+
+  const auto chunk_count = table.chunk_count();
+  writer.write(static_cast<uint32_t>(chunk_count));
+
+  for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+    writer.write_string(table.column_name(column_id));
+    writer.write_string(table.column_type(column_id));
+    writer.write(static_cast<uint8_t>(table.column_is_nullable(column_id)));
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    writer.write(chunk.size());
+    for (ColumnID column_id{0}; column_id < table.col_count(); ++column_id) {
+      resolve_data_type(table.column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        write_column<ColumnDataType>(writer, *chunk.get_column(column_id));
+      });
+    }
+  }
+
+  writer.finish();
+}
+
+std::shared_ptr<Table> map_binary_table(const std::string& file_name) {
+  BinaryReader reader(MappedFile::open(file_name));
+
+  const auto magic = reader.read<uint64_t>();
+  Assert(std::memcmp(&magic, MAGIC, sizeof(MAGIC)) == 0, "map_binary_table: Not a binary table file: " + file_name);
+  // the version of a file from a machine with another byte order is unreadable as well, so the byte order comes first
+  const auto version = reader.read<uint32_t>();
+  Assert(reader.read<uint32_t>() == BYTE_ORDER_MARK,
+         "map_binary_table: " + file_name + " was written on a machine with a different byte order.");
+  Assert(version == FORMAT_VERSION, "map_binary_table: Unsupported format version in " + file_name);
+
+  const auto chunk_size = reader.read<uint32_t>();
+  const auto column_count = reader.read<uint16_t>();
+  const auto chunk_count = reader.read<uint32_t>();
+
+  auto table = std::make_shared<Table>(chunk_size);
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    auto name = reader.read_string();
+    auto type = reader.read_string();
+    table->add_column_definition(name, type, reader.read<uint8_t>());
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto row_count = reader.read<uint32_t>();
+    Chunk chunk;
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      std::shared_ptr<BaseColumn> column;
+      resolve_data_type(table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        column = read_column<ColumnDataType>(reader);
+      });
+      Assert(column, "map_binary_table: Unknown column type " + table->column_type(column_id));
+      Assert(column->size() == row_count, "map_binary_table: Column size does not match the chunk size.");
+      chunk.add_column(std::move(column));
+    }
+    table->emplace_chunk(std::move(chunk));
+  }
+
+  return table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A columnar binary file format for tables, whose arrays mirror the in-memory layout of the columns closely enough to
+ * be used in place after the file is memory-mapped:
+ *
+ *   header       "OPSMTBL" magic, format version, byte order mark, chunk size, number of columns and chunks
+ *   columns      name, type, and nullability of each column
+ *   chunks       number of rows and, for each column, its encoding followed by the arrays of that encoding
+ *
+ * Each array is stored as its number of elements, followed by the raw elements starting at the next multiple of
+ * 64 bytes. Values are stored in the byte order of the machine that wrote the file.
+ *
+ *   Unencoded         values (strings: offsets into the concatenated characters, characters)
+ *   Dictionary        dictionary (strings: as StringDictionary), attribute vector kind, width, and value ids / words
+ *   RunLength         zone map, values (strings as above), end positions
+ *   FrameOfReference  zone map, block minima, bit width and words of the offsets
+ *
+ * A zone map is stored as whether it is empty, whether it has seen a NaN, and, unless it is empty, its min and max.
+ * Nullable columns are followed by the words of their ValidityBitmap. ReferenceColumns are materialized and stored
+ * as Unencoded columns.
+ */
+
+// Writes a table to a file chunk by chunk, using large sequential writes. Throws if the file cannot be written.
+void write_binary_table(const Table& table, const std::string& file_name);
+
+// Loads a table written by write_binary_table by mapping the file into memory. Dictionary and FrameOfReference
+// columns refer to the mapping without copying or decoding their dictionaries, attribute vectors, and offsets, so
+// loading them only costs the page faults of the data that is actually accessed. ValueColumns and RunLengthColumns
+// are copied into vectors with one bulk copy per array (strings: one string per value). The mapping is released once
+// the table and all columns loaded from it are gone.
+std::shared_ptr<Table> map_binary_table(const std::string& file_name);
+
+}  // namespace opossum
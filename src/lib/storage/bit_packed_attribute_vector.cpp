@@ -0,0 +1,129 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Decodes one block of 64 values. Since the bit width is known at compile time, all shifts and word offsets are
+// constants and the loop can be unrolled and vectorized (e.g., into AVX2 shifts when compiled with -march=native).
+template <uint8_t BitWidth>
+void unpack_block(const uint64_t* in, ValueID* out) {
+  constexpr auto mask = (uint64_t{1} << BitWidth) - 1;
+
+  for (size_t index = 0; index < BitPackedAttributeVector::BLOCK_SIZE; ++index) {
+    const auto bit = index * BitWidth;
+    const auto word = bit / 64;
+    const auto shift = bit % 64;
+
+    auto value = in[word] >> shift;
+    // masking the shift amount does not change the result but keeps the compiler from warning about shifting by 64
+    if (shift + BitWidth > 64) value |= in[word + 1] << ((64 - shift) & 63);
+    out[index] = ValueID{static_cast<ValueID::base_type>(value & mask)};
+  }
+}
+
+using UnpackFunction = void (*)(const uint64_t*, ValueID*);
+
+template <size_t... BitWidths>
+constexpr std::array<UnpackFunction, sizeof...(BitWidths)> make_unpack_functions(std::index_sequence<BitWidths...>) {
+  return {{&unpack_block<static_cast<uint8_t>(BitWidths)>...}};
+}
+
+// maps a bit width to its specialized decoding function, index 0 is unused
+constexpr auto unpack_functions = make_unpack_functions(std::make_index_sequence<33>{});
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   std::pmr::memory_resource* memory_resource)
+    : _size(size),
+      _bit_width(bit_width),
+      _mask((uint64_t{1} << bit_width) - 1),
+      _data(word_count(size, bit_width), memory_resource) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width of BitPackedAttributeVector has to be between 1 and 32.");
+}
+
+BitPackedAttributeVector::BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                                                   ColumnBuffer<uint64_t>&& words)
+    : _size(size), _bit_width(bit_width), _mask((uint64_t{1} << bit_width) - 1), _data(std::move(words)) {
+  Assert(bit_width >= 1 && bit_width <= 32, "Bit width of BitPackedAttributeVector has to be between 1 and 32.");
+  Assert(_data.size() == word_count(size, bit_width), "Number of words does not match the size and bit width.");
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  DebugAssert(i < _size, "Out of bounds get() on BitPackedAttributeVector.");
+  const auto bit = i * _bit_width;
+  const auto word = bit / 64;
+  const auto shift = bit % 64;
+
+  auto value = _data[word] >> shift;
+  if (shift + _bit_width > 64) value |= _data[word + 1] << (64 - shift);
+  return ValueID{static_cast<ValueID::base_type>(value & _mask)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(i < _size, "Out of bounds set() on BitPackedAttributeVector.");
+  DebugAssert(static_cast<uint64_t>(value_id) <= _mask,
+              "ValueID does not fit into the bit width of the BitPackedAttributeVector.");
+  const auto value = static_cast<uint64_t>(value_id);
+  const auto bit = i * _bit_width;
+  const auto word = bit / 64;
+  const auto shift = bit % 64;
+
+  const auto data = _data.mutable_data();
+  data[word] = (data[word] & ~(_mask << shift)) | (value << shift);
+  if (shift + _bit_width > 64) {
+    const auto remaining_shift = 64 - shift;
+    data[word + 1] = (data[word + 1] & ~(_mask >> remaining_shift)) | (value >> remaining_shift);
+  }
+}
+
+void BitPackedAttributeVector::get_range(const size_t begin, const size_t count, ValueID* out) const {
+  DebugAssert(begin + count <= _size, "Out of bounds get_range() on BitPackedAttributeVector.");
+  const auto end = begin + count;
+  auto position = begin;
+
+  // decode values one by one until we reach the start of a block
+  for (; position < end && position % BLOCK_SIZE != 0; ++position) {
+    *out++ = get(position);
+  }
+
+  const auto unpack_block = unpack_functions[_bit_width];
+  for (; position + BLOCK_SIZE <= end; position += BLOCK_SIZE) {
+    // a block of 64 values with a width of b bits always starts at word (block index * b)
+    unpack_block(_data.data() + position / BLOCK_SIZE * _bit_width, out);
+    out += BLOCK_SIZE;
+  }
+
+  for (; position < end; ++position) {
+    *out++ = get(position);
+  }
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return (_bit_width + 7) / 8; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const { return sizeof(*this) + _data.estimate_memory_usage(); }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+const ColumnBuffer<uint64_t>& BitPackedAttributeVector::words() const { return _data; }
+
+size_t BitPackedAttributeVector::word_count(const size_t size, const uint8_t bit_width) {
+  // one additional word so that a value starting in the last word can always be read with two loads
+  return (size * bit_width + 63) / 64 + 1;
+}
+
+uint8_t BitPackedAttributeVector::bit_width_for(const uint32_t max_value) {
+  if (max_value == 0) return 1;
+  return 32 - __builtin_clz(max_value);
+}
+
+}  // namespace opossum
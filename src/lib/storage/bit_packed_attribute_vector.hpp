@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "column_buffer.hpp"
+#include "column_memory_resource.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// BitPackedAttributeVector stores each value id with the minimal number of bits (1 to 32) needed to represent the
+// largest value id of the column. Value ids are packed back to back into 64-bit words, so a value may span two words.
+//
+// Values are decoded in blocks of 64: a block of 64 values with a bit width of b occupies exactly b words, which
+// allows decoding it with a fully unrolled loop that is specialized for each bit width and vectorized by the compiler.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  // number of values that are decoded together by get_range()
+  static constexpr size_t BLOCK_SIZE = 64;
+
+  // creates a vector of `size` zero-initialized value ids, each using `bit_width` bits
+  // the words are allocated from the given memory resource
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width,
+                           std::pmr::memory_resource* memory_resource = column_memory_resource());
+
+  // creates a vector on top of existing words, e.g., in a memory-mapped file, see words()
+  BitPackedAttributeVector(const size_t size, const uint8_t bit_width, ColumnBuffer<uint64_t>&& words);
+
+  ValueID get(const size_t i) const final;
+
+  void set(const size_t i, const ValueID value_id) final;
+
+  void get_range(const size_t begin, const size_t count, ValueID* out) const final;
+
+  size_t size() const final;
+
+  // returns the number of whole bytes a value would need, i.e., the bit width rounded up
+  AttributeVectorWidth width() const final;
+
+  size_t estimate_memory_usage() const final;
+
+  // returns the number of bits used per value
+  uint8_t bit_width() const;
+
+  // returns the words that hold the packed values
+  const ColumnBuffer<uint64_t>& words() const;
+
+  // returns the number of words needed for `size` values of `bit_width` bits
+  static size_t word_count(const size_t size, const uint8_t bit_width);
+
+  // returns the smallest bit width that can represent all values in [0, max_value]
+  static uint8_t bit_width_for(const uint32_t max_value);
+
+ protected:
+  const size_t _size;
+  const uint8_t _bit_width;
+  const uint64_t _mask;
+
+  // contains one additional word so that a value starting in the last word can always be read with two loads
+  ColumnBuffer<uint64_t> _data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include "bloom_filter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "type_cast.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+// odd constants that derive eight independent bit positions from one 32-bit hash, as in Parquet's split block filters
+constexpr uint64_t BIT_SALTS[BlockedBloomFilter::WORDS_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                                     0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                                     0x9efc4947U, 0x5c6bfb31U};
+
+template <typename T>
+void insert_column(BlockedBloomFilter& bloom_filter, const BaseColumn& column) {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    for (ValueID value_id{0}; value_id < dictionary_column->unique_values_count(); ++value_id) {
+      bloom_filter.insert(bloom_filter_hash(dictionary_column->value_by_value_id(value_id)));
+    }
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    for (const auto& value : run_length_column->values()) bloom_filter.insert(bloom_filter_hash(value));
+  } else if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    // NULLs are never searched for, so they are left out
+    const auto& values = value_column->values();
+    for (size_t index = 0; index < values.size(); ++index) {
+      if (!column.is_null(index)) bloom_filter.insert(bloom_filter_hash(values[index]));
+    }
+  } else {
+    for (size_t index = 0; index < column.size(); ++index) {
+      if (!column.is_null(index)) bloom_filter.insert(bloom_filter_hash(type_cast<T>(column[index])));
+    }
+  }
+}
+
+template <typename T>
+size_t distinct_value_bound(const BaseColumn& column) {
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    return dictionary_column->unique_values_count();
+  }
+  if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    return run_length_column->values().size();
+  }
+  return column.size();
+}
+
+}  // namespace
+
+BlockedBloomFilter::BlockedBloomFilter(const size_t value_count, const uint32_t bits_per_value)
+    : _words(std::max(size_t{1}, (value_count * bits_per_value + 511) / 512) * WORDS_PER_BLOCK) {}
+
+void BlockedBloomFilter::insert(const uint64_t hash) {
+  const auto block = _block(hash);
+  for (size_t word = 0; word < WORDS_PER_BLOCK; ++word) {
+    _words[block + word] |= _mask(hash, word);
+  }
+}
+
+bool BlockedBloomFilter::may_contain(const uint64_t hash) const {
+  const auto block = _block(hash);
+  for (size_t word = 0; word < WORDS_PER_BLOCK; ++word) {
+    if (!(_words[block + word] & _mask(hash, word))) return false;
+  }
+  return true;
+}
+
+size_t BlockedBloomFilter::memory_usage() const { return _words.size() * sizeof(uint64_t); }
+
+double BlockedBloomFilter::false_positive_rate() const {
+  // a lookup hits a random block and a random bit in each of its words
+  double rate_sum = 0.0;
+  for (size_t block = 0; block < _words.size(); block += WORDS_PER_BLOCK) {
+    double block_rate = 1.0;
+    for (size_t word = 0; word < WORDS_PER_BLOCK; ++word) {
+      block_rate *= __builtin_popcountll(_words[block + word]) / 64.0;
+    }
+    rate_sum += block_rate;
+  }
+  return rate_sum / static_cast<double>(_words.size() / WORDS_PER_BLOCK);
+}
+
+size_t BlockedBloomFilter::_block(const uint64_t hash) const {
+  // maps the upper 32 bits of the hash to a block without a division
+  const auto block_count = _words.size() / WORDS_PER_BLOCK;
+  return ((hash >> 32) * block_count >> 32) * WORDS_PER_BLOCK;
+}
+
+uint64_t BlockedBloomFilter::_mask(const uint64_t hash, const size_t word) {
+  const auto bit = ((hash & 0xFFFFFFFFU) * BIT_SALTS[word] & 0xFFFFFFFFU) >> 26;
+  return uint64_t{1} << bit;
+}
+
+std::shared_ptr<BlockedBloomFilter> build_bloom_filter(const std::string& column_type, const BaseColumn& column,
+                                                       const uint32_t bits_per_value) {
+  std::shared_ptr<BlockedBloomFilter> bloom_filter;
+  resolve_data_type(column_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    bloom_filter = std::make_shared<BlockedBloomFilter>(distinct_value_bound<ColumnDataType>(column), bits_per_value);
+    insert_column<ColumnDataType>(*bloom_filter, column);
+  });
+  return bloom_filter;
+}
+
+}  // namespace opossum
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BlockedBloomFilter is a Bloom filter whose bits are grouped into blocks of one cache line (512 bits). A value sets
+// or tests one bit in each of the eight words of a single block, so an insert or a lookup touches one cache line only.
+// Compared to a classic Bloom filter, this costs a slightly higher false-positive rate for the same size.
+//
+// Values are inserted and looked up by their hash, see bloom_filter_hash.
+class BlockedBloomFilter : private Noncopyable {
+ public:
+  static constexpr size_t WORDS_PER_BLOCK = 8;
+
+  // creates an empty filter sized for the given number of distinct values
+  explicit BlockedBloomFilter(const size_t value_count, const uint32_t bits_per_value = 10);
+
+  void insert(const uint64_t hash);
+
+  // returns false if no value with this hash has been inserted, true if one probably has been
+  bool may_contain(const uint64_t hash) const;
+
+  // returns the size of the filter in bytes
+  size_t memory_usage() const;
+
+  // returns the probability that may_contain() returns true for a value that has not been inserted, computed from the
+  // bits that are actually set
+  double false_positive_rate() const;
+
+ protected:
+  // returns the index of the first word of the block for a hash
+  size_t _block(const uint64_t hash) const;
+
+  // returns the bit to set or test in each word of a block
+  static uint64_t _mask(const uint64_t hash, const size_t word);
+
+  std::vector<uint64_t> _words;
+};
+
+// Hashes a value for a BlockedBloomFilter. Values that compare equal have the same hash, e.g., 0.0 and -0.0, and a
+// std::string has the same hash as a std::string_view of it.
+template <typename T>
+uint64_t bloom_filter_hash(const T& value) {
+  uint64_t bits;
+  if constexpr (std::is_convertible<const T&, std::string_view>::value) {
+    bits = std::hash<std::string_view>{}(value);
+  } else if constexpr (std::is_floating_point<T>::value) {
+    const auto normalized_value = value == 0 ? 0.0 : static_cast<double>(value);
+    std::memcpy(&bits, &normalized_value, sizeof(bits));
+  } else {
+    bits = static_cast<uint64_t>(value);
+  }
+
+  // finalizer of MurmurHash3, which spreads all input bits over the whole hash (std::hash of numbers is the identity)
+  bits ^= bits >> 33;
+  bits *= 0xff51afd7ed558ccdULL;
+  bits ^= bits >> 33;
+  bits *= 0xc4ceb9fe1a85ec53ULL;
+  bits ^= bits >> 33;
+  return bits;
+}
+
+// Builds a filter containing all values of a column of the given data type (e.g., "int"). Dictionary and run-length
+// encoded columns only insert each distinct value or run once.
+std::shared_ptr<BlockedBloomFilter> build_bloom_filter(const std::string& column_type, const BaseColumn& column,
+                                                       const uint32_t bits_per_value);
+
+}  // namespace opossum
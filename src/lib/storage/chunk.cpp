@@ -1,20 +1,43 @@
+#include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
+#include "bloom_filter.hpp"
 #include "chunk.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_column(std::shared_ptr<BaseColumn> column) { _columns.push_back(column); }
+Chunk::Chunk(Chunk&& other)
+    : _columns(std::move(other._columns)),
+      _indices(std::move(other._indices)),
+      _bloom_filters(std::move(other._bloom_filters)),
+      _numa_node(other._numa_node.load()) {}
+
+Chunk& Chunk::operator=(Chunk&& other) {
+  _columns = std::move(other._columns);
+  _indices = std::move(other._indices);
+  _bloom_filters = std::move(other._bloom_filters);
+  _numa_node = other._numa_node.load();
+  return *this;
+}
+
+void Chunk::add_column(std::shared_ptr<BaseColumn> column) {
+  _columns.push_back(column);
+  _indices.push_back(nullptr);
+  _bloom_filters.push_back(nullptr);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(_columns.size() == values.size(), "Inserted number of columns does not match.");
@@ -23,7 +46,71 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
-std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const { return _columns.at(column_id); }
+std::shared_ptr<BaseColumn> Chunk::get_column(ColumnID column_id) const {
+  return std::atomic_load(&_columns.at(column_id));
+}
+
+void Chunk::replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column) {
+  DebugAssert(column->size() == size(), "Replacing column must have the same size as the chunk.");
+  const auto replaced_column = std::atomic_exchange(&_columns.at(column_id), column);
+
+  for (auto& index_slot : _indices) {
+    const auto index = std::atomic_load(&index_slot);
+    if (!index) continue;
+
+    const auto indexed_columns = index->indexed_columns();
+    if (std::find(indexed_columns.begin(), indexed_columns.end(), replaced_column) != indexed_columns.end()) {
+      std::atomic_store(&index_slot, std::shared_ptr<BaseIndex>());
+    }
+  }
+}
+
+void Chunk::adopt_columns(Chunk&& other) {
+  DebugAssert(size() == 0, "Only an empty chunk can adopt the columns of another chunk.");
+  DebugAssert(col_count() == other.col_count(), "Number of columns of the adopted chunk does not match.");
+
+  for (auto column_id = col_count(); column_id-- > 0;) {
+    std::atomic_store(&_indices[column_id], std::move(other._indices[column_id]));
+    std::atomic_store(&_bloom_filters[column_id], std::move(other._bloom_filters[column_id]));
+    std::atomic_store(&_columns[column_id], std::move(other._columns[column_id]));
+  }
+  _numa_node = other._numa_node.load();
+}
+
+std::shared_ptr<const BaseIndex> Chunk::get_index(ColumnID column_id) const {
+  return std::atomic_load(&_indices.at(column_id));
+}
+
+void Chunk::set_bloom_filter(ColumnID column_id, std::shared_ptr<const BlockedBloomFilter> bloom_filter) {
+  std::atomic_store(&_bloom_filters.at(column_id), std::move(bloom_filter));
+}
+
+std::shared_ptr<const BlockedBloomFilter> Chunk::get_bloom_filter(ColumnID column_id) const {
+  return std::atomic_load(&_bloom_filters.at(column_id));
+}
+
+MemoryUsageBreakdown Chunk::estimate_memory_usage_breakdown() const {
+  MemoryUsageBreakdown breakdown;
+  for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+    const auto column = get_column(column_id);
+    breakdown[column->encoding_name()] += column->estimate_memory_usage();
+
+    if (const auto bloom_filter = get_bloom_filter(column_id)) {
+      breakdown["BloomFilter"] += sizeof(BlockedBloomFilter) + bloom_filter->memory_usage();
+    }
+  }
+  return breakdown;
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  const auto breakdown = estimate_memory_usage_breakdown();
+  return std::accumulate(breakdown.begin(), breakdown.end(), size_t{0},
+                         [](const size_t sum, const auto& entry) { return sum + entry.second; });
+}
+
+NodeID Chunk::numa_node() const { return NodeID{_numa_node.load()}; }
+
+void Chunk::set_numa_node(NodeID numa_node) { _numa_node = numa_node; }
 
 uint16_t Chunk::col_count() const { return _columns.size(); }
 
@@ -32,7 +119,7 @@ uint32_t Chunk::size() const {
     return 0;
   }
 
-  return _columns[0]->size();
+  return get_column(ColumnID{0})->size();
 }
 
 }  // namespace opossum
@@ -4,17 +4,24 @@
 #include <shared_mutex>
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "index/base_index.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/numa.hpp"
 
 namespace opossum {
 
-class BaseIndex;
 class BaseColumn;
+class BlockedBloomFilter;
+
+// estimated memory usage in bytes per column encoding (see BaseColumn::encoding_name) and for Bloom filters
+using MemoryUsageBreakdown = std::map<std::string, size_t>;
 
 // A chunk is a horizontal partition of a table.
 // It stores the data column by column.
@@ -24,10 +31,10 @@ class Chunk : private Noncopyable {
  public:
   Chunk() = default;
 
-  // we need to explicitly set the move constructor to default when
-  // we overwrite the copy constructor
-  Chunk(Chunk&&) = default;
-  Chunk& operator=(Chunk&&) = default;
+  // we need to explicitly define the move constructor when we overwrite the copy constructor
+  // it is not defaulted because the NUMA node is atomic
+  Chunk(Chunk&& other);
+  Chunk& operator=(Chunk&& other);
 
   // adds a column to the "right" of the chunk
   void add_column(std::shared_ptr<BaseColumn> column);
@@ -45,9 +52,67 @@ class Chunk : private Noncopyable {
   // Returns the column at a given position
   std::shared_ptr<BaseColumn> get_column(ColumnID column_id) const;
 
+  // Replaces the column at a given position, e.g., with an encoded version of the same data.
+  // The replacement is atomic: a concurrent get_column() returns either the old or the new column.
+  // All indexes on the replaced column are dropped.
+  void replace_column(ColumnID column_id, std::shared_ptr<BaseColumn> column);
+
+  // Moves the columns, indexes, Bloom filters, and NUMA node of another chunk with the same number of columns into
+  // this empty chunk, which keeps references to this chunk valid. Each column is swapped in atomically and the first
+  // column, which determines size(), comes last. A concurrent reader that sees a non-zero size() therefore also sees
+  // all other columns filled.
+  void adopt_columns(Chunk&& other);
+
+  // Creates an index of the given type (e.g., GroupKeyIndex) on one or more columns and returns it. The index is
+  // registered for its first column, replacing an existing index with the same first column. Like replace_column,
+  // this is atomic with regard to concurrent get_index() calls.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    DebugAssert(!column_ids.empty(), "An index needs at least one column.");
+    std::vector<std::shared_ptr<const BaseColumn>> columns;
+    for (const auto& column_id : column_ids) {
+      columns.push_back(get_column(column_id));
+    }
+
+    auto index = std::make_shared<Index>(columns);
+    std::atomic_store(&_indices.at(column_ids.front()), std::shared_ptr<BaseIndex>(index));
+    return index;
+  }
+
+  // returns the index whose first column is the given column, or nullptr if there is none
+  std::shared_ptr<const BaseIndex> get_index(ColumnID column_id) const;
+
+  // Sets the Bloom filter of a column, which is built when the column is compressed (see Table::enable_bloom_filters).
+  // Since compression does not change the values of a column, the filter is kept when the column is replaced.
+  void set_bloom_filter(ColumnID column_id, std::shared_ptr<const BlockedBloomFilter> bloom_filter);
+
+  // returns the Bloom filter of a column, or nullptr if there is none
+  std::shared_ptr<const BlockedBloomFilter> get_bloom_filter(ColumnID column_id) const;
+
+  // Returns the estimated memory usage of the columns by their encoding and of the Bloom filters under "BloomFilter".
+  // Indexes are not included.
+  MemoryUsageBreakdown estimate_memory_usage_breakdown() const;
+
+  // returns the estimated memory usage of the columns and Bloom filters in bytes
+  size_t estimate_memory_usage() const;
+
+  // Returns the NUMA node the chunk is placed on, or UNDEFINED_NODE_ID if it is left to the operating system.
+  // Columns that are encoded from now on allocate their memory on that node (see Table::compress_chunk). Existing
+  // columns are not moved.
+  NodeID numa_node() const;
+  void set_numa_node(NodeID numa_node);
+
  protected:
   // Implementation goes here
   std::vector<std::shared_ptr<BaseColumn>> _columns;
+
+  // the index whose first column is the respective column, if any
+  std::vector<std::shared_ptr<BaseIndex>> _indices;
+
+  std::vector<std::shared_ptr<const BlockedBloomFilter>> _bloom_filters;
+
+  // written by the table when it places the chunk, read by concurrent compressions
+  std::atomic<NodeID::base_type> _numa_node{UNDEFINED_NODE_ID};
 };
 
 }  // namespace opossum
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "column_memory_resource.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// ColumnBuffer is a fixed-size array of trivially copyable values, e.g., the words of an attribute vector or the
+// entries of a dictionary. It either owns its memory, which is allocated from a memory resource, or refers to memory
+// owned by someone else, e.g., a memory-mapped file (see map_binary_table). In the latter case, it keeps the owner
+// alive and is read-only. Reads go through a plain pointer in both cases.
+template <typename T>
+class ColumnBuffer : private Noncopyable {
+  static_assert(std::is_trivially_copyable<T>::value, "ColumnBuffer only holds trivially copyable values.");
+
+ public:
+  using value_type = T;
+  using const_iterator = const T*;
+
+  // creates an owning buffer of `size` zero-initialized values
+  explicit ColumnBuffer(const size_t size = 0, std::pmr::memory_resource* memory_resource = column_memory_resource())
+      : _owned_values(size, memory_resource), _values(_owned_values.data()), _size(size) {}
+
+  // creates an owning buffer that holds a copy of the values in [first, last)
+  template <typename Iterator>
+  ColumnBuffer(Iterator first, Iterator last, std::pmr::memory_resource* memory_resource = column_memory_resource())
+      : _owned_values(first, last, memory_resource), _values(_owned_values.data()), _size(_owned_values.size()) {}
+
+  // takes over the memory of a vector
+  explicit ColumnBuffer(std::pmr::vector<T>&& values)
+      : _owned_values(std::move(values)), _values(_owned_values.data()), _size(_owned_values.size()) {}
+
+  // creates a read-only buffer that refers to `size` values at `values`, which stay valid as long as `owner` lives
+  ColumnBuffer(const T* values, const size_t size, std::shared_ptr<const void> owner)
+      : _values(values), _size(size), _owner(std::move(owner)) {}
+
+  ColumnBuffer(ColumnBuffer&& other)
+      : _owned_values(std::move(other._owned_values)),
+        _values(other._owner ? other._values : _owned_values.data()),
+        _size(other._size),
+        _owner(std::move(other._owner)) {}
+
+  const T& operator[](const size_t i) const { return _values[i]; }
+
+  // same as operator[], but throws std::out_of_range if the index is invalid
+  const T& at(const size_t i) const {
+    if (i >= _size) throw std::out_of_range("ColumnBuffer index out of range.");
+    return _values[i];
+  }
+
+  // returns the values of an owning buffer for writing
+  T* mutable_data() {
+    DebugAssert(!_owner, "A ColumnBuffer that refers to external memory is read-only.");
+    return _owned_values.data();
+  }
+
+  const T* data() const { return _values; }
+  size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const_iterator begin() const { return _values; }
+  const_iterator end() const { return _values + _size; }
+
+  const T& front() const { return _values[0]; }
+  const T& back() const { return _values[_size - 1]; }
+
+  // returns whether the values live in memory owned by someone else
+  bool is_external() const { return _owner != nullptr; }
+
+  // returns the number of bytes of the values, which are allocated by the buffer unless they are external
+  size_t estimate_memory_usage() const {
+    return _owner ? _size * sizeof(T) : _owned_values.capacity() * sizeof(T);
+  }
+
+ protected:
+  std::pmr::vector<T> _owned_values;
+  const T* _values;
+  size_t _size;
+  std::shared_ptr<const void> _owner;
+};
+
+}  // namespace opossum
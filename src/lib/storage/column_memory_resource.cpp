@@ -0,0 +1,32 @@
+#include "column_memory_resource.hpp"
+
+#include <atomic>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::pmr::memory_resource* default_column_memory_resource() {
+  // intentionally leaked: columns of static tables (e.g., in the StorageManager) may be destroyed after the pool
+  static auto* const pool = new std::pmr::synchronized_pool_resource();
+  return pool;
+}
+
+std::atomic<std::pmr::memory_resource*> current_column_memory_resource{nullptr};
+
+}  // namespace
+
+std::pmr::memory_resource* column_memory_resource() {
+  const auto memory_resource = current_column_memory_resource.load();
+  return memory_resource ? memory_resource : default_column_memory_resource();
+}
+
+std::pmr::memory_resource* set_column_memory_resource(std::pmr::memory_resource* memory_resource) {
+  Assert(memory_resource, "Column memory resource must not be null.");
+  const auto previous = current_column_memory_resource.exchange(memory_resource);
+  return previous ? previous : default_column_memory_resource();
+}
+
+}  // namespace opossum
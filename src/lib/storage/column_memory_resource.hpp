@@ -0,0 +1,16 @@
+#pragma once
+
+#include <memory_resource>
+
+namespace opossum {
+
+// Returns the memory resource that encoded columns allocate their attribute vectors and dictionaries from, unless they
+// are given a resource of their own. By default, this is a process-wide synchronized pool, which serves the many
+// same-sized buffers of long-lived chunks from recycled blocks instead of going to the global heap for each of them.
+std::pmr::memory_resource* column_memory_resource();
+
+// Replaces the resource returned by column_memory_resource() and returns the previous one. Columns keep using the
+// resource they were created with, so a replaced resource has to outlive all columns that were allocated from it.
+std::pmr::memory_resource* set_column_memory_resource(std::pmr::memory_resource* memory_resource);
+
+}  // namespace opossum
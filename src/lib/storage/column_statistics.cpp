@@ -0,0 +1,315 @@
+#include "column_statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "run_length_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+bool is_nan(const T& value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+template <typename Entry>
+void merge_equal_values(std::vector<Entry>& entries, const bool sum_distinct_counts) {
+  if (entries.empty()) return;
+
+  auto merged = entries.begin();
+  for (auto entry = std::next(entries.begin()); entry != entries.end(); ++entry) {
+    if (entry->value == merged->value) {
+      merged->row_count += entry->row_count;
+      merged->distinct_count = sum_distinct_counts ? merged->distinct_count + entry->distinct_count
+                                                   : std::max(merged->distinct_count, entry->distinct_count);
+    } else {
+      *++merged = std::move(*entry);
+    }
+  }
+  entries.erase(std::next(merged), entries.end());
+}
+
+// merges groups of neighbouring entries so that at most max_size entries remain, each group is represented by its
+// largest value
+template <typename Entry>
+void compact(std::vector<Entry>& entries, const size_t max_size) {
+  if (entries.size() <= max_size) return;
+
+  const auto group_size = (entries.size() + max_size - 1) / max_size;
+  std::vector<Entry> compacted;
+  compacted.reserve(max_size);
+  for (size_t begin = 0; begin < entries.size(); begin += group_size) {
+    const auto end = std::min(begin + group_size, entries.size());
+    auto group = entries[end - 1];
+    for (auto index = begin; index < end - 1; ++index) {
+      group.row_count += entries[index].row_count;
+      group.distinct_count += entries[index].distinct_count;
+    }
+    compacted.push_back(std::move(group));
+  }
+  entries = std::move(compacted);
+}
+
+}  // namespace
+
+template <typename T>
+bool ColumnStatistics<T>::refresh_chunk(const ChunkID chunk_id, const std::shared_ptr<BaseColumn>& column) {
+  if (_chunk_samples.size() <= chunk_id.t) _chunk_samples.resize(chunk_id.t + 1);
+
+  auto& chunk_sample = _chunk_samples[chunk_id];
+  if (chunk_sample.column.lock() == column && chunk_sample.column_size == column->size()) return false;
+
+  chunk_sample.column = column;
+  chunk_sample.column_size = column->size();
+  chunk_sample.null_count = column->validity() ? column->validity()->null_count() : 0;
+  chunk_sample.entries = _summarize(*column, chunk_sample.nan_count);
+  return true;
+}
+
+template <typename T>
+void ColumnStatistics<T>::rebuild_histogram() {
+  std::vector<SampleEntry> entries;
+  _null_count = 0;
+  _nan_count = 0;
+  for (const auto& chunk_sample : _chunk_samples) {
+    _null_count += static_cast<float>(chunk_sample.null_count);
+    _nan_count += chunk_sample.nan_count;
+    entries.insert(entries.end(), chunk_sample.entries.begin(), chunk_sample.entries.end());
+  }
+  std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.value < rhs.value; });
+
+  // a value that occurs in several chunks is still only one distinct value
+  merge_equal_values(entries, false);
+
+  _row_count = 0;
+  _distinct_count = 0;
+  for (const auto& entry : entries) {
+    _row_count += entry.row_count;
+    _distinct_count += entry.distinct_count;
+  }
+
+  // entries are never split, so a frequent value ends up in a bucket of its own
+  _buckets.clear();
+  const auto bucket_depth = _row_count / BUCKET_COUNT;
+  for (const auto& entry : entries) {
+    if (_buckets.empty() || _buckets.back().row_count >= bucket_depth) {
+      _buckets.push_back(Bucket{entry.value, entry.value, 0, 0});
+    }
+    auto& bucket = _buckets.back();
+    bucket.max = entry.value;
+    bucket.row_count += entry.row_count;
+    bucket.distinct_count += entry.distinct_count;
+  }
+}
+
+template <typename T>
+float ColumnStatistics<T>::estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  // NaN rows only satisfy OpNotEquals, just like every row compared with a NaN search value
+  const auto value = type_cast<T>(search_value);
+  if constexpr (std::is_floating_point<T>::value) {
+    if (std::isnan(value)) return scan_type == ScanType::OpNotEquals ? 1 - null_fraction() : 0;
+  }
+  const auto nan_selectivity = scan_type == ScanType::OpNotEquals ? nan_fraction() : 0;
+  if (_row_count == 0) return nan_selectivity;
+
+  float selectivity = 0;
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      selectivity = _estimate_equal(value);
+      break;
+    case ScanType::OpNotEquals:
+      selectivity = 1 - _estimate_equal(value);
+      break;
+    case ScanType::OpLessThan:
+      selectivity = _estimate_less_than(value);
+      break;
+    case ScanType::OpLessThanEquals:
+      selectivity = _estimate_less_than(value) + _estimate_equal(value);
+      break;
+    case ScanType::OpGreaterThan:
+      selectivity = 1 - _estimate_less_than(value) - _estimate_equal(value);
+      break;
+    case ScanType::OpGreaterThanEquals:
+      selectivity = 1 - _estimate_less_than(value);
+      break;
+  }
+  return std::clamp(selectivity, 0.0f, 1.0f) * (1 - null_fraction() - nan_fraction()) + nan_selectivity;
+}
+
+template <typename T>
+float ColumnStatistics<T>::estimate_distinct_count() const {
+  return _distinct_count;
+}
+
+template <typename T>
+float ColumnStatistics<T>::row_count() const {
+  return _row_count + _null_count + _nan_count;
+}
+
+template <typename T>
+float ColumnStatistics<T>::null_fraction() const {
+  const auto total_row_count = row_count();
+  return total_row_count == 0 ? 0 : _null_count / total_row_count;
+}
+
+template <typename T>
+float ColumnStatistics<T>::nan_fraction() const {
+  const auto total_row_count = row_count();
+  return total_row_count == 0 ? 0 : _nan_count / total_row_count;
+}
+
+template <typename T>
+std::vector<typename ColumnStatistics<T>::SampleEntry> ColumnStatistics<T>::_summarize(const BaseColumn& column,
+                                                                                              float& nan_count) {
+  std::vector<SampleEntry> entries;
+  nan_count = 0;
+  const auto size = column.size();
+  const auto validity = column.validity();
+  const auto null_count = validity ? validity->null_count() : 0;
+  if (size == null_count) return entries;
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    // The dictionary already holds the sorted distinct values, only their frequencies have to be counted. The last
+    // counters are the ones of the NaN and the NULL value id, which are not part of the summary.
+    std::vector<float> counts(dictionary_column->unique_values_count() + 1);
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    std::vector<ValueID> value_ids(1024);
+    for (size_t begin = 0; begin < size; begin += value_ids.size()) {
+      const auto count = std::min(value_ids.size(), size - begin);
+      attribute_vector.get_range(begin, count, value_ids.data());
+      for (size_t index = 0; index < count; ++index) ++counts[value_ids[index]];
+    }
+
+    const auto nan_value_id = dictionary_column->nan_value_id();
+    if (nan_value_id != dictionary_column->null_value_id()) nan_count = counts[nan_value_id];
+
+    entries.reserve(nan_value_id.t);
+    for (size_t index = 0; index < nan_value_id.t; ++index) {
+      entries.push_back(SampleEntry{T(dictionary_column->value_by_value_id(ValueID(index))), counts[index], 1});
+    }
+    compact(entries, MAX_SAMPLE_SIZE);
+    return entries;
+  }
+
+  if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    const auto& values = run_length_column->values();
+    const auto& end_positions = run_length_column->end_positions();
+    ChunkOffset run_begin = 0;
+    for (size_t run = 0; run < values.size(); ++run) {
+      // NULL rows are part of the runs of their neighbours
+      auto valid_count = static_cast<float>(end_positions[run] - run_begin);
+      if (validity) {
+        valid_count = 0;
+        validity->for_each_valid(run_begin, end_positions[run], [&](size_t) { ++valid_count; });
+      }
+      if (is_nan(values[run])) {
+        nan_count += valid_count;
+      } else if (valid_count > 0) {
+        entries.push_back(SampleEntry{values[run], valid_count, 1});
+      }
+      run_begin = end_positions[run];
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.value < rhs.value; });
+    merge_equal_values(entries, false);
+    compact(entries, MAX_SAMPLE_SIZE);
+    return entries;
+  }
+
+  // all other columns are sampled at evenly spaced positions
+  const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column);
+  const auto get_value = [&](const size_t index) -> T {
+    if (value_column) return value_column->values()[index];
+    if constexpr (std::is_integral<T>::value) {
+      if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+        return frame_of_reference_column->get(index);
+      }
+    }
+    return type_cast<T>(column[index]);
+  };
+
+  const auto sample_size = std::min(size, MAX_SAMPLE_SIZE);
+  std::vector<T> sample;
+  sample.reserve(sample_size);
+  size_t sampled_nan_count = 0;
+  for (size_t index = 0; index < sample_size; ++index) {
+    const auto position = index * size / sample_size;
+    if (validity && !validity->is_valid(position)) continue;
+
+    const auto value = get_value(position);
+    if (is_nan(value)) {
+      ++sampled_nan_count;
+    } else {
+      sample.push_back(value);
+    }
+  }
+  if (sample.empty() && sampled_nan_count == 0) return entries;
+  std::sort(sample.begin(), sample.end());
+
+  // Each sampled row stands for `scale` rows. Values seen only once in the sample are probably rare and stand for
+  // sqrt(scale) distinct values, values seen more often are assumed to be frequent enough to have been found
+  // (Guaranteed-Error Estimator, Charikar et al., PODS 2000). Without sampling, scale is 1 and the counts are exact.
+  const auto scale = static_cast<float>(size - null_count) / static_cast<float>(sample.size() + sampled_nan_count);
+  nan_count = static_cast<float>(sampled_nan_count) * scale;
+  for (auto begin = sample.begin(); begin != sample.end();) {
+    const auto end = std::upper_bound(begin, sample.end(), *begin);
+    const auto count = static_cast<float>(std::distance(begin, end));
+    entries.push_back(SampleEntry{*begin, count * scale, count == 1 ? std::sqrt(scale) : 1.0f});
+    begin = end;
+  }
+  return entries;
+}
+
+template <typename T>
+float ColumnStatistics<T>::_estimate_equal(const T& search_value) const {
+  // values within a bucket are assumed to be equally frequent
+  const auto bucket = std::lower_bound(_buckets.begin(), _buckets.end(), search_value,
+                                       [](const auto& bucket, const T& value) { return bucket.max < value; });
+  if (bucket == _buckets.end() || search_value < bucket->min) return 0;
+
+  return bucket->row_count / std::max(bucket->distinct_count, 1.0f) / _row_count;
+}
+
+template <typename T>
+float ColumnStatistics<T>::_estimate_less_than(const T& search_value) const {
+  float row_count = 0;
+  for (const auto& bucket : _buckets) {
+    if (bucket.max < search_value) {
+      row_count += bucket.row_count;
+      continue;
+    }
+
+    // Values within a bucket are assumed to be uniformly distributed between its bounds. The rows that are equal to the
+    // search value are left out, which keeps `<= max` from counting them twice.
+    if (bucket.min < search_value) {
+      const auto other_row_count = bucket.row_count - bucket.row_count / std::max(bucket.distinct_count, 1.0f);
+      if constexpr (std::is_arithmetic<T>::value) {
+        const auto fraction = (static_cast<double>(search_value) - static_cast<double>(bucket.min)) /
+                              (static_cast<double>(bucket.max) - static_cast<double>(bucket.min));
+        row_count += other_row_count * static_cast<float>(fraction);
+      } else {
+        row_count += other_row_count / 2;
+      }
+    }
+    break;
+  }
+  return row_count / _row_count;
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BaseColumnStatistics describes the value distribution of one column of a table, see TableStatistics
+class BaseColumnStatistics : private Noncopyable {
+ public:
+  virtual ~BaseColumnStatistics() = default;
+
+  // Recomputes the statistics of a chunk if its column has been replaced (e.g., by compress_chunk) or has grown since
+  // the last call. Returns whether anything changed. The histogram is only rebuilt by rebuild_histogram().
+  virtual bool refresh_chunk(const ChunkID chunk_id, const std::shared_ptr<BaseColumn>& column) = 0;
+
+  // merges the statistics of all chunks into the equi-depth histogram used for estimations
+  virtual void rebuild_histogram() = 0;
+
+  // returns the estimated fraction of rows for which `value <scan_type> search_value` holds, between 0 and 1
+  // NULL rows never satisfy a predicate
+  virtual float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const = 0;
+
+  // returns the estimated number of distinct values in the column
+  virtual float estimate_distinct_count() const = 0;
+
+  // returns the number of rows the statistics are based on, including NULLs and NaNs
+  virtual float row_count() const = 0;
+
+  // returns the fraction of rows that are NULL
+  virtual float null_fraction() const = 0;
+
+  // returns the fraction of rows that are NaN, which only satisfy OpNotEquals
+  virtual float nan_fraction() const = 0;
+};
+
+// ColumnStatistics keeps a compact summary per chunk, a list of values together with the number of rows and distinct
+// values each of them stands for. For DictionaryColumns, the summary is exact and built from the dictionary and one
+// pass over the attribute vector. For RunLengthColumns, it is built from the runs. All other columns are sampled.
+// The summaries of all chunks are merged into an equi-depth histogram, in which each bucket covers about the same
+// number of rows. NULLs and NaNs are only counted, they are not part of the summaries, as NaN has no place in the
+// order of the values.
+template <typename T>
+class ColumnStatistics : public BaseColumnStatistics {
+ public:
+  // the maximum number of entries in the summary of a chunk
+  static constexpr size_t MAX_SAMPLE_SIZE = 4096;
+
+  // the number of buckets of the histogram
+  static constexpr size_t BUCKET_COUNT = 100;
+
+  bool refresh_chunk(const ChunkID chunk_id, const std::shared_ptr<BaseColumn>& column) override;
+
+  void rebuild_histogram() override;
+
+  float estimate_selectivity(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  float estimate_distinct_count() const override;
+
+  float row_count() const override;
+
+  float null_fraction() const override;
+
+  float nan_fraction() const override;
+
+ protected:
+  struct SampleEntry {
+    T value;
+    float row_count;
+    float distinct_count;
+  };
+
+  struct ChunkSample {
+    // the column the sample was taken from, used to detect replaced or grown columns
+    std::weak_ptr<BaseColumn> column;
+    size_t column_size = 0;
+    size_t null_count = 0;
+    // estimated like the entries if the column is sampled
+    float nan_count = 0;
+    std::vector<SampleEntry> entries;
+  };
+
+  struct Bucket {
+    T min;
+    T max;
+    float row_count;
+    float distinct_count;
+  };
+
+  // summarizes the valid values of a column that are not NaN, the number of NaN rows is written to nan_count
+  static std::vector<SampleEntry> _summarize(const BaseColumn& column, float& nan_count);
+
+  // returns the estimated fraction of all rows whose value is equal to / less than the search value
+  float _estimate_equal(const T& search_value) const;
+  float _estimate_less_than(const T& search_value) const;
+
+  std::vector<ChunkSample> _chunk_samples;
+  std::vector<Bucket> _buckets;
+  // the number of rows that are neither NULL nor NaN, which the histogram is based on
+  float _row_count = 0;
+  float _null_count = 0;
+  float _nan_count = 0;
+  float _distinct_count = 0;
+};
+
+}  // namespace opossum
@@ -1,18 +1,30 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
-#include <map>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "base_dictionary_column.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "column_buffer.hpp"
+#include "column_memory_resource.hpp"
+#include "dictionary_encoder.hpp"
 #include "fitted_attribute_vector.hpp"
+#include "string_dictionary.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "value_column.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
@@ -26,123 +38,209 @@ class ValueColumn;
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
 // Dictionary is a specific column type that stores all its values in a vector
+// Strings are stored in a StringDictionary, which keeps all values in one contiguous buffer
 template <typename T>
-class DictionaryColumn : public BaseColumn {
+class DictionaryColumn : public BaseDictionaryColumn {
  public:
+  using Dictionary = std::conditional_t<std::is_same<T, std::string>::value, StringDictionary, ColumnBuffer<T>>;
+
+  // the type used to hand out dictionary entries without copying them
+  using ValueView = std::conditional_t<std::is_same<T, std::string>::value, std::string_view, const T&>;
+
   /**
    * Creates a Dictionary column from a given value column.
+   * The dictionary and the attribute vector are allocated from the given memory resource.
    */
-  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column) {
+  explicit DictionaryColumn(const std::shared_ptr<BaseColumn>& base_column,
+                            std::pmr::memory_resource* memory_resource = column_memory_resource()) {
     const auto value_column = dynamic_cast<ValueColumn<T>*>(base_column.get());
     if (!value_column) {
       throw std::logic_error("Dictionary column could not be initialized due to a type mismatch.");
     }
 
-    const auto& values = value_column->values();
-
-    // Build the dictionary from distinct values
-    _dictionary = std::make_shared<std::vector<T>>(values.begin(), values.end());
-    std::sort(_dictionary->begin(), _dictionary->end());
-    _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
-
-    // Decide which size the IDs need to have based on the dictionary size
-    if (_dictionary->size() < std::numeric_limits<uint8_t>::max() - 1) {
-      _attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(value_column->size());
-    } else if (_dictionary->size() < std::numeric_limits<uint16_t>::max() - 1) {
-      _attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(value_column->size());
-    } else if (_dictionary->size() < std::numeric_limits<uint32_t>::max() - 1) {
-      _attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(value_column->size());
+    // Build the dictionary from distinct values and compute the ValueID of each row. NULLs are left out of the
+    // dictionary and get the ValueID after the last dictionary entry, see null_value_id().
+    const auto validity = value_column->validity();
+    const auto has_nulls = validity && validity->null_count() > 0;
+    if (validity) _validity = *validity;
+
+    auto encoding = has_nulls ? _encode_valid_values(value_column->values(), *validity)
+                              : dictionary_encode(value_column->values());
+    auto& distinct_values = encoding.dictionary;
+
+    // Decide which size the IDs need to have based on the dictionary size, which is also the NULL value id. Value IDs
+    // that need less than a byte are bit-packed, wider ones use the byte-aligned FittedAttributeVectors, which can be
+    // accessed without any shifting.
+    const auto bit_width = BitPackedAttributeVector::bit_width_for(static_cast<uint32_t>(distinct_values.size()));
+    if (bit_width < 8) {
+      _attribute_vector = std::make_shared<BitPackedAttributeVector>(value_column->size(), bit_width, memory_resource);
+    } else if (distinct_values.size() < std::numeric_limits<uint8_t>::max() - 1) {
+      _attribute_vector = std::make_shared<FittedAttributeVector<uint8_t>>(value_column->size(), memory_resource);
+    } else if (distinct_values.size() < std::numeric_limits<uint16_t>::max() - 1) {
+      _attribute_vector = std::make_shared<FittedAttributeVector<uint16_t>>(value_column->size(), memory_resource);
+    } else if (distinct_values.size() < std::numeric_limits<uint32_t>::max() - 1) {
+      _attribute_vector = std::make_shared<FittedAttributeVector<uint32_t>>(value_column->size(), memory_resource);
     } else {
       throw std::logic_error("Value IDs does not fit in 4 bytes.");
     }
 
-    std::map<T, ValueID> value_IDs;
-    size_t index = 0;
-    for (const auto& value : values) {
-      const auto mapIt = value_IDs.find(value);
-      if (mapIt != value_IDs.end()) {
-        _attribute_vector->set(index, mapIt->second);
-      } else {
-        const auto dictIt = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
-        const auto id = ValueID(std::distance(_dictionary->begin(), dictIt));
-        value_IDs[value] = id;
-        _attribute_vector->set(index, id);
-      }
-      ++index;
+    for (size_t index = 0; index < encoding.value_ids.size(); ++index) {
+      _attribute_vector->set(index, encoding.value_ids[index]);
+    }
+
+    _add_dictionary_to_zone_map(distinct_values);
+    if (validity) _zone_map.add_nulls(validity->null_count());
+
+    if constexpr (std::is_same<T, std::string>::value) {
+      _dictionary = std::make_shared<StringDictionary>(distinct_values, memory_resource);
+    } else {
+      _dictionary = std::make_shared<Dictionary>(distinct_values.begin(), distinct_values.end(), memory_resource);
     }
   }
 
+  /**
+   * Creates a Dictionary column from an existing dictionary and attribute vector, e.g., from a memory-mapped file.
+   * NULL rows have to be marked in the ValidityBitmap and hold the value id after the last dictionary entry.
+   */
+  DictionaryColumn(std::shared_ptr<Dictionary> dictionary, std::shared_ptr<BaseAttributeVector> attribute_vector,
+                   std::optional<ValidityBitmap> validity)
+      : _dictionary(std::move(dictionary)),
+        _attribute_vector(std::move(attribute_vector)),
+        _validity(std::move(validity)) {
+    Assert(!_validity || _validity->size() == _attribute_vector->size(),
+           "ValidityBitmap does not match the size of the attribute vector.");
+    _add_dictionary_to_zone_map(*_dictionary);
+    if (_validity) _zone_map.add_nulls(_validity->null_count());
+  }
+
   // return the value at a certain position. If you want to write efficient operators, back off!
-  const AllTypeVariant operator[](const size_t i) const override { return _dictionary->at(_attribute_vector->get(i)); }
+  const AllTypeVariant operator[](const size_t i) const override {
+    if (is_null(i)) return NULL_VALUE;
+    return get(i);
+  }
 
-  // return the value at a certain position.
-  const T get(const size_t i) const { return _dictionary->at(_attribute_vector->get(i)); }
+  // return the value at a certain position, which must not be NULL.
+  const T get(const size_t i) const { return T(_dictionary->at(_attribute_vector->get(i))); }
 
   // dictionary columns are immutable
   void append(const AllTypeVariant&) override { throw std::logic_error("Dictionary columns are immutable."); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const Dictionary> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
-  std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
+  std::shared_ptr<const BaseAttributeVector> attribute_vector() const override { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
+  ValueView value_by_value_id(ValueID value_id) const { return _dictionary->at(value_id); }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
   ValueID lower_bound(T value) const {
-    const auto it = std::lower_bound(_dictionary->begin(), _dictionary->end(), value);
-    if (it == _dictionary->end()) {
-      return INVALID_VALUE_ID;
+    size_t index;
+    if constexpr (std::is_same<T, std::string>::value) {
+      index = _dictionary->lower_bound(value);
     } else {
-      return ValueID(std::distance(_dictionary->begin(), it));
+      index = std::distance(_dictionary->begin(), std::lower_bound(_dictionary->begin(), _dictionary->end(), value));
     }
+    return index == _dictionary->size() ? INVALID_VALUE_ID : ValueID(index);
   }
 
   // same as lower_bound(T), but accepts an AllTypeVariant
-  ValueID lower_bound(const AllTypeVariant& value) const {
-    const T val = opossum::type_cast<T>(value);
-
-    if (!val) {
-      return INVALID_VALUE_ID;
-    }
-
-    return lower_bound(val);
-  }
+  ValueID lower_bound(const AllTypeVariant& value) const override { return lower_bound(type_cast<T>(value)); }
 
   // returns the first value ID that refers to a value > the search value
   // returns INVALID_VALUE_ID if all values are smaller than or equal to the search value
+  // a NaN entry, which is not larger than any value, is treated as the largest value, see nan_value_id()
   ValueID upper_bound(T value) const {
-    const auto it = std::upper_bound(_dictionary->begin(), _dictionary->end(), value);
-    if (it == _dictionary->end()) {
-      return INVALID_VALUE_ID;
+    size_t index;
+    if constexpr (std::is_same<T, std::string>::value) {
+      index = _dictionary->upper_bound(value);
+    } else if constexpr (std::is_floating_point<T>::value) {
+      const auto is_less = [](const T& lhs, const T& rhs) { return lhs < rhs || std::isnan(rhs); };
+      index = std::distance(_dictionary->begin(),
+                            std::upper_bound(_dictionary->begin(), _dictionary->end(), value, is_less));
     } else {
-      return ValueID(std::distance(_dictionary->begin(), it));
+      index = std::distance(_dictionary->begin(), std::upper_bound(_dictionary->begin(), _dictionary->end(), value));
     }
+    return index == _dictionary->size() ? INVALID_VALUE_ID : ValueID(index);
   }
 
   // same as upper_bound(T), but accepts an AllTypeVariant
-  ValueID upper_bound(const AllTypeVariant& value) const {
-    const T val = opossum::type_cast<T>(value);
+  ValueID upper_bound(const AllTypeVariant& value) const override { return upper_bound(type_cast<T>(value)); }
 
-    if (!val) {
-      return INVALID_VALUE_ID;
-    }
+  // return the number of unique_values (dictionary entries)
+  size_t unique_values_count() const override { return _dictionary->size(); }
+
+  // NULLs are represented by the value id after the last dictionary entry, which is smaller than INVALID_VALUE_ID
+  ValueID null_value_id() const override { return ValueID{static_cast<ValueID::base_type>(_dictionary->size())}; }
 
-    return lower_bound(val);
+  // NaN is the last entry of a floating-point dictionary, right before the NULL value id
+  ValueID nan_value_id() const override {
+    if constexpr (std::is_floating_point<T>::value) {
+      if (_dictionary->size() > 0 && std::isnan((*_dictionary)[_dictionary->size() - 1])) {
+        return ValueID{null_value_id() - 1};
+      }
+    }
+    return null_value_id();
   }
 
-  // return the number of unique_values (dictionary entries)
-  size_t unique_values_count() const { return _dictionary->size(); }
+  const ValidityBitmap* validity() const override { return _validity ? &*_validity : nullptr; }
 
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); }
 
+  size_t estimate_memory_usage() const override {
+    auto bytes = sizeof(*this) + _attribute_vector->estimate_memory_usage() + _dictionary->estimate_memory_usage();
+    if constexpr (!std::is_same<T, std::string>::value) bytes += sizeof(Dictionary);
+    return bytes + (_validity ? _validity->estimate_memory_usage() : 0);
+  }
+
+  std::string encoding_name() const override { return "Dictionary"; }
+
+  // returns the smallest and the largest value of the column
+  const ZoneMap<T>& zone_map() const { return _zone_map; }
+
+  ZoneMapMatch match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const override {
+    return _zone_map.match(scan_type, type_cast<T>(search_value));
+  }
+
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  // dictionary-encodes the valid values and assigns the NULL value id (the dictionary size) to all other rows
+  static DictionaryEncoding<T> _encode_valid_values(const std::vector<T>& values, const ValidityBitmap& validity) {
+    std::vector<T> valid_values;
+    valid_values.reserve(values.size() - validity.null_count());
+    validity.for_each_valid(0, values.size(), [&](const size_t index) { valid_values.push_back(values[index]); });
+
+    auto encoding = dictionary_encode(valid_values);
+    const auto null_value_id = ValueID{static_cast<ValueID::base_type>(encoding.dictionary.size())};
+    std::vector<ValueID> value_ids(values.size(), null_value_id);
+    auto valid_index = size_t{0};
+    validity.for_each_valid(0, values.size(),
+                            [&](const size_t index) { value_ids[index] = encoding.value_ids[valid_index++]; });
+    encoding.value_ids = std::move(value_ids);
+    return encoding;
+  }
+
+  // The dictionary is sorted, so its first and last entries are the bounds of the zone map. A NaN is the last entry
+  // of a floating-point dictionary, in which case the entry before it is the upper bound.
+  template <typename Values>
+  void _add_dictionary_to_zone_map(const Values& dictionary) {
+    if (dictionary.size() == 0) return;
+
+    _zone_map.add(T(dictionary[0]));
+    _zone_map.add(T(dictionary[dictionary.size() - 1]));
+    if constexpr (std::is_floating_point<T>::value) {
+      if (dictionary.size() > 1 && std::isnan(dictionary[dictionary.size() - 1])) {
+        _zone_map.add(T(dictionary[dictionary.size() - 2]));
+      }
+    }
+  }
+
+  std::shared_ptr<Dictionary> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
+  ZoneMap<T> _zone_map;
+  std::optional<ValidityBitmap> _validity;
 };
 
 }  // namespace opossum
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The result of dictionary_encode(): the sorted distinct values and the ValueID of every input value
+template <typename T>
+struct DictionaryEncoding {
+  std::vector<T> dictionary;
+  std::vector<ValueID> value_ids;
+};
+
+/**
+ * Dictionary-encodes a vector of values in O(n + d log d) for n values with d distinct values.
+ *
+ * 1. An open-addressing hash table (linear probing) assigns each distinct value a temporary id in the order of its
+ *    first occurrence. Only the ids are stored in the table, the values live in a dense vector.
+ * 2. Only the d distinct values are sorted, which yields the rank, i.e., the final ValueID, of every temporary id.
+ * 3. The temporary id of every row is replaced by its rank.
+ *
+ * In contrast to sorting all n values and looking each of them up in a std::map, this touches every value only once,
+ * sorts much less data for low-cardinality columns, and does not allocate a node per distinct value.
+ *
+ * NaN never equals itself and is not ordered with respect to any value. All NaNs therefore bypass the hash table, share
+ * one dictionary entry, and are placed after all other entries, so that the sort only compares ordered values.
+ */
+template <typename T>
+DictionaryEncoding<T> dictionary_encode(const std::vector<T>& values) {
+  constexpr auto EMPTY_SLOT = std::numeric_limits<uint32_t>::max();
+  constexpr auto NAN_ID = EMPTY_SLOT - 1;
+
+  DictionaryEncoding<T> encoding;
+  std::vector<T> distinct_values;
+
+  // holds the temporary ids until they are replaced by the final ValueIDs
+  auto& value_ids = encoding.value_ids;
+  value_ids.resize(values.size());
+
+  // the table is kept at most half full, its size is a power of two so that the slot can be computed with a shift
+  auto slot_bits = 4u;
+  std::vector<uint32_t> slots(size_t{1} << slot_bits, EMPTY_SLOT);
+
+  // Fibonacci hashing spreads the often poorly distributed std::hash values (e.g., the identity for integers)
+  const auto slot_for = [&](const T& value) {
+    return static_cast<size_t>((std::hash<T>{}(value) * UINT64_C(0x9E3779B97F4A7C15)) >> (64 - slot_bits));
+  };
+
+  const auto insert_into_slots = [&](const uint32_t temporary_id) {
+    const auto mask = slots.size() - 1;
+    auto slot = slot_for(distinct_values[temporary_id]);
+    while (slots[slot] != EMPTY_SLOT) slot = (slot + 1) & mask;
+    slots[slot] = temporary_id;
+  };
+
+  // the first NaN of the input, which represents all of them in the dictionary
+  std::optional<T> nan_value;
+
+  for (size_t index = 0; index < values.size(); ++index) {
+    const auto& value = values[index];
+    if constexpr (std::is_floating_point<T>::value) {
+      if (std::isnan(value)) {
+        if (!nan_value) nan_value = value;
+        value_ids[index] = ValueID{NAN_ID};
+        continue;
+      }
+    }
+
+    const auto mask = slots.size() - 1;
+
+    auto slot = slot_for(value);
+    while (slots[slot] != EMPTY_SLOT && !(distinct_values[slots[slot]] == value)) slot = (slot + 1) & mask;
+
+    if (slots[slot] != EMPTY_SLOT) {
+      value_ids[index] = ValueID{slots[slot]};
+      continue;
+    }
+
+    const auto temporary_id = static_cast<uint32_t>(distinct_values.size());
+    distinct_values.push_back(value);
+    value_ids[index] = ValueID{temporary_id};
+    slots[slot] = temporary_id;
+
+    if (distinct_values.size() * 2 > slots.size()) {
+      ++slot_bits;
+      slots.assign(size_t{1} << slot_bits, EMPTY_SLOT);
+      for (uint32_t rehashed_id = 0; rehashed_id < distinct_values.size(); ++rehashed_id) {
+        insert_into_slots(rehashed_id);
+      }
+    }
+  }
+
+  // sort the distinct values indirectly to find the rank of each temporary id
+  std::vector<uint32_t> sorted_temporary_ids(distinct_values.size());
+  std::iota(sorted_temporary_ids.begin(), sorted_temporary_ids.end(), 0u);
+  std::sort(sorted_temporary_ids.begin(), sorted_temporary_ids.end(),
+            [&](const uint32_t lhs, const uint32_t rhs) { return distinct_values[lhs] < distinct_values[rhs]; });
+
+  encoding.dictionary.reserve(distinct_values.size() + (nan_value ? 1 : 0));
+  std::vector<ValueID> ranks(distinct_values.size());
+  for (uint32_t rank = 0; rank < sorted_temporary_ids.size(); ++rank) {
+    encoding.dictionary.push_back(std::move(distinct_values[sorted_temporary_ids[rank]]));
+    ranks[sorted_temporary_ids[rank]] = ValueID{rank};
+  }
+
+  const auto nan_rank = ValueID{static_cast<ValueID::base_type>(encoding.dictionary.size())};
+  if (nan_value) encoding.dictionary.push_back(*nan_value);
+
+  for (auto& value_id : value_ids) {
+    value_id = value_id == NAN_ID ? nan_rank : ranks[value_id];
+  }
+
+  return encoding;
+}
+
+}  // namespace opossum
@@ -1,16 +1,27 @@
 #pragma once
 
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 #include "base_attribute_vector.hpp"
+#include "column_buffer.hpp"
+#include "column_memory_resource.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 template <typename T>
 class FittedAttributeVector : public BaseAttributeVector {
  public:
-  explicit FittedAttributeVector(const size_t size) : BaseAttributeVector() { _data.resize(size); }
+  // creates a vector of `size` zero-initialized value ids, allocated from the given memory resource
+  explicit FittedAttributeVector(const size_t size,
+                                 std::pmr::memory_resource* memory_resource = column_memory_resource())
+      : BaseAttributeVector(), _data(size, memory_resource) {}
+
+  // creates an attribute vector on top of existing value ids, e.g., in a memory-mapped file
+  explicit FittedAttributeVector(ColumnBuffer<T>&& data) : BaseAttributeVector(), _data(std::move(data)) {}
 
   ValueID get(const size_t i) const {
     DebugAssert(i < _data.size(), "Out of bounds get() on FittedAttributeVector.");
@@ -19,15 +30,27 @@ class FittedAttributeVector : public BaseAttributeVector {
 
   void set(const size_t i, const ValueID value_id) final {
     DebugAssert(i < _data.size(), "Out of bounds set() on FittedAttributeVector.");
-    _data[i] = value_id;
+    _data.mutable_data()[i] = value_id;
+  }
+
+  void get_range(const size_t begin, const size_t count, ValueID* out) const final {
+    DebugAssert(begin + count <= _data.size(), "Out of bounds get_range() on FittedAttributeVector.");
+    for (size_t index = 0; index < count; ++index) {
+      out[index] = ValueID(_data[begin + index]);
+    }
   }
 
   size_t size() const { return _data.size(); }
 
   AttributeVectorWidth width() const { return sizeof(T); }
 
+  size_t estimate_memory_usage() const final { return sizeof(*this) + _data.estimate_memory_usage(); }
+
+  // returns the value ids
+  const ColumnBuffer<T>& data() const { return _data; }
+
  protected:
-  std::vector<T> _data;
+  ColumnBuffer<T> _data;
 };
 
 }  // namespace opossum
@@ -0,0 +1,270 @@
+#include "frame_of_reference_column.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceColumn<T>::FrameOfReferenceColumn(const std::shared_ptr<BaseColumn>& base_column,
+                                                  std::pmr::memory_resource* memory_resource) {
+  const auto value_column = dynamic_cast<ValueColumn<T>*>(base_column.get());
+  if (!value_column) {
+    throw std::logic_error("FrameOfReference column could not be initialized due to a type mismatch.");
+  }
+
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto& values = value_column->values();
+  const auto validity = value_column->validity();
+  if (validity) _validity = *validity;
+
+  // offsets are computed in the unsigned domain, where the subtraction cannot overflow
+  std::vector<uint32_t> offsets(values.size());
+  uint32_t max_offset = 0;
+  for (size_t block_begin = 0; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, values.size());
+
+    // NULL rows are stored with an offset of 0 and neither affect the minimum nor the zone map
+    const auto for_each_value = [&](const auto& function) {
+      if (validity) {
+        validity->for_each_valid(block_begin, block_end, function);
+      } else {
+        for (auto index = block_begin; index < block_end; ++index) function(index);
+      }
+    };
+
+    std::optional<T> minimum;
+    for_each_value([&](const size_t index) {
+      if (!minimum || values[index] < *minimum) minimum = values[index];
+      _zone_map.add(values[index]);
+    });
+    _block_minima.push_back(minimum.value_or(T{}));
+
+    for_each_value([&](const size_t index) {
+      const auto offset = static_cast<UnsignedT>(values[index]) - static_cast<UnsignedT>(*minimum);
+      if (offset > std::numeric_limits<uint32_t>::max()) {
+        throw std::logic_error("Value range of a FrameOfReference block does not fit in 4 bytes.");
+      }
+      offsets[index] = static_cast<uint32_t>(offset);
+      max_offset = std::max(max_offset, offsets[index]);
+    });
+  }
+
+  if (validity) _zone_map.add_nulls(validity->null_count());
+
+  _offsets = std::make_shared<BitPackedAttributeVector>(
+      values.size(), BitPackedAttributeVector::bit_width_for(max_offset), memory_resource);
+  for (size_t index = 0; index < offsets.size(); ++index) {
+    _offsets->set(index, ValueID{offsets[index]});
+  }
+}
+
+template <typename T>
+bool FrameOfReferenceColumn<T>::is_encodable(const std::shared_ptr<BaseColumn>& base_column) {
+  const auto value_column = dynamic_cast<ValueColumn<T>*>(base_column.get());
+  if (!value_column) return false;
+
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto& values = value_column->values();
+  const auto validity = value_column->validity();
+
+  for (size_t block_begin = 0; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, values.size());
+
+    std::optional<T> minimum;
+    std::optional<T> maximum;
+    const auto add_value = [&](const size_t index) {
+      if (!minimum || values[index] < *minimum) minimum = values[index];
+      if (!maximum || values[index] > *maximum) maximum = values[index];
+    };
+    if (validity) {
+      validity->for_each_valid(block_begin, block_end, add_value);
+    } else {
+      for (auto index = block_begin; index < block_end; ++index) add_value(index);
+    }
+
+    if (minimum && static_cast<UnsignedT>(*maximum) - static_cast<UnsignedT>(*minimum) >
+                       std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+FrameOfReferenceColumn<T>::FrameOfReferenceColumn(std::vector<T>&& block_minima,
+                                                  std::shared_ptr<BitPackedAttributeVector> offsets,
+                                                  const ZoneMap<T>& zone_map, std::optional<ValidityBitmap> validity)
+    : _zone_map(zone_map),
+      _block_minima(std::move(block_minima)),
+      _offsets(std::move(offsets)),
+      _validity(std::move(validity)) {
+  Assert(_block_minima.size() == (_offsets->size() + BLOCK_SIZE - 1) / BLOCK_SIZE,
+         "Number of block minima does not match the size of the FrameOfReference column.");
+  Assert(!_validity || _validity->size() == _offsets->size(), "ValidityBitmap does not match the size of the column.");
+  Assert(zone_map.null_count() == 0, "The NULLs of a FrameOfReference column are counted from its ValidityBitmap.");
+  if (_validity) _zone_map.add_nulls(_validity->null_count());
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceColumn<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  if (is_null(i)) return NULL_VALUE;
+  return get(i);
+}
+
+template <typename T>
+const T FrameOfReferenceColumn<T>::get(const size_t i) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto minimum = static_cast<UnsignedT>(_block_minima[i / BLOCK_SIZE]);
+  return static_cast<T>(minimum + static_cast<UnsignedT>(_offsets->get(i)));
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::append(const AllTypeVariant&) {
+  throw std::logic_error("FrameOfReference columns are immutable.");
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+size_t FrameOfReferenceColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_block_minima) + _offsets->estimate_memory_usage() +
+         (_validity ? _validity->estimate_memory_usage() : 0);
+}
+
+template <typename T>
+std::string FrameOfReferenceColumn<T>::encoding_name() const {
+  return "FrameOfReference";
+}
+
+template <typename T>
+const ValidityBitmap* FrameOfReferenceColumn<T>::validity() const {
+  return _validity ? &*_validity : nullptr;
+}
+
+template <typename T>
+const std::vector<T>& FrameOfReferenceColumn<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceColumn<T>::offsets() const {
+  return _offsets;
+}
+
+template <typename T>
+void FrameOfReferenceColumn<T>::scan(const ScanType scan_type, const AllTypeVariant& search_value,
+                                     const ChunkID chunk_id, PosList& pos_list) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto typed_search_value = type_cast<T>(search_value);
+  const auto max_offset = (uint64_t{1} << _offsets->bit_width()) - 1;
+
+  // whether the predicate holds for values that are smaller / greater than every value in a block
+  const auto matches_smaller_values = scan_type == ScanType::OpGreaterThan ||
+                                      scan_type == ScanType::OpGreaterThanEquals ||
+                                      scan_type == ScanType::OpNotEquals;
+  const auto matches_greater_values = scan_type == ScanType::OpLessThan || scan_type == ScanType::OpLessThanEquals ||
+                                      scan_type == ScanType::OpNotEquals;
+
+  std::vector<ValueID> decoded_offsets(BLOCK_SIZE);
+  for (size_t block = 0; block < _block_minima.size(); ++block) {
+    const auto block_begin = static_cast<ChunkOffset>(block * BLOCK_SIZE);
+    const auto block_end = static_cast<ChunkOffset>(std::min(block_begin + size_t{BLOCK_SIZE}, size()));
+
+    const auto emit_row = [&](const size_t chunk_offset) {
+      pos_list.push_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+    };
+
+    const auto emit_block = [&]() {
+      if (_validity) {
+        _validity->for_each_valid(block_begin, block_end, emit_row);
+        return;
+      }
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        pos_list.push_back(RowID{chunk_id, chunk_offset});
+      }
+    };
+
+    const auto minimum = _block_minima[block];
+    if (typed_search_value < minimum) {
+      if (matches_smaller_values) emit_block();
+      continue;
+    }
+
+    const auto search_offset = static_cast<UnsignedT>(typed_search_value) - static_cast<UnsignedT>(minimum);
+    if (search_offset > max_offset) {
+      if (matches_greater_values) emit_block();
+      continue;
+    }
+
+    _offsets->get_range(block_begin, block_end - block_begin, decoded_offsets.data());
+    const auto typed_search_offset = static_cast<ValueID::base_type>(search_offset);
+
+    // The scan type is resolved once per block so that the inner loop does not branch on it. The matches of 64 rows
+    // are collected in one word, which removes the NULLs with a single AND (blocks start at multiples of 64).
+    const auto emit_matches = [&](auto comparator) {
+      for (auto word_begin = block_begin; word_begin < block_end; word_begin += 64) {
+        const auto word_end = std::min(word_begin + ChunkOffset{64}, block_end);
+        auto matches = uint64_t{0};
+        for (auto chunk_offset = word_begin; chunk_offset < word_end; ++chunk_offset) {
+          const auto match = comparator(decoded_offsets[chunk_offset - block_begin].t, typed_search_offset);
+          matches |= static_cast<uint64_t>(match) << (chunk_offset - word_begin);
+        }
+        if (_validity) matches &= _validity->word(word_begin / 64);
+        ValidityBitmap::for_each_set_bit(matches, word_begin, emit_row);
+      }
+    };
+
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        emit_matches(std::equal_to<ValueID::base_type>{});
+        break;
+      case ScanType::OpNotEquals:
+        emit_matches(std::not_equal_to<ValueID::base_type>{});
+        break;
+      case ScanType::OpLessThan:
+        emit_matches(std::less<ValueID::base_type>{});
+        break;
+      case ScanType::OpLessThanEquals:
+        emit_matches(std::less_equal<ValueID::base_type>{});
+        break;
+      case ScanType::OpGreaterThan:
+        emit_matches(std::greater<ValueID::base_type>{});
+        break;
+      case ScanType::OpGreaterThanEquals:
+        emit_matches(std::greater_equal<ValueID::base_type>{});
+        break;
+    }
+  }
+}
+
+template <typename T>
+const ZoneMap<T>& FrameOfReferenceColumn<T>::zone_map() const {
+  return _zone_map;
+}
+
+template <typename T>
+ZoneMapMatch FrameOfReferenceColumn<T>::match_zone_map(const ScanType scan_type,
+                                                       const AllTypeVariant& search_value) const {
+  return _zone_map.match(scan_type, type_cast<T>(search_value));
+}
+
+EXPLICITLY_INSTANTIATE_INTEGRAL_COLUMN_TYPES(FrameOfReferenceColumn);
+
+}  // namespace opossum
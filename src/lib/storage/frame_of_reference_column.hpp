@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "column_memory_resource.hpp"
+#include "types.hpp"
+#include "zone_map.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceColumn is a specific column type for integral values with a narrow value range, e.g., IDs or
+// timestamps. The column is split into blocks of BLOCK_SIZE rows. For each block, the minimum is stored and every
+// value is represented by its offset to that minimum. All offsets are bit-packed with the width of the largest offset
+// of the whole column, so that they form a single attribute vector which is written to and mapped from disk as is.
+template <typename T>
+class FrameOfReferenceColumn : public BaseColumn {
+  static_assert(std::is_integral<T>::value, "FrameOfReferenceColumn only supports integral types.");
+
+ public:
+  static constexpr ChunkOffset BLOCK_SIZE = 2048;
+
+  /**
+   * Creates a FrameOfReference column from a given value column.
+   * Throws if the values of a block span a range that does not fit into 32 bits.
+   * The offsets are allocated from the given memory resource.
+   */
+  explicit FrameOfReferenceColumn(const std::shared_ptr<BaseColumn>& base_column,
+                                  std::pmr::memory_resource* memory_resource = column_memory_resource());
+
+  // returns whether the valid values of each block of the given value column span a range that fits into 32 bits
+  static bool is_encodable(const std::shared_ptr<BaseColumn>& base_column);
+
+  /**
+   * Creates a FrameOfReference column from existing blocks, e.g., from a memory-mapped file, see block_minima() and
+   * offsets(). The zone map only covers the valid values, its NULLs are counted from the ValidityBitmap.
+   */
+  FrameOfReferenceColumn(std::vector<T>&& block_minima, std::shared_ptr<BitPackedAttributeVector> offsets,
+                         const ZoneMap<T>& zone_map, std::optional<ValidityBitmap> validity);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position, which must not be NULL.
+  const T get(const size_t i) const;
+
+  // frame of reference columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  std::string encoding_name() const override;
+
+  // returns the smallest and the largest value of the column
+  const ZoneMap<T>& zone_map() const;
+
+  ZoneMapMatch match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  const ValidityBitmap* validity() const override;
+
+  // returns the minimum of the valid values of each block
+  const std::vector<T>& block_minima() const;
+
+  // returns the offsets of all values to the minimum of their block
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const;
+
+  // Appends the positions of all rows for which `value <scan_type> search_value` holds to the given PosList.
+  // The search value is rewritten into the offset domain of each block, so that the offsets can be compared without
+  // decoding the actual values. Blocks whose range lies entirely on one side of the search value are decided at once.
+  void scan(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+            PosList& pos_list) const;
+
+ protected:
+  ZoneMap<T> _zone_map;
+  std::vector<T> _block_minima;
+  std::shared_ptr<BitPackedAttributeVector> _offsets;
+  std::optional<ValidityBitmap> _validity;
+};
+
+}  // namespace opossum
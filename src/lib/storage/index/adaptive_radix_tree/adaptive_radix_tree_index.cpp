@@ -0,0 +1,124 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& indexed_columns)
+    : _indexed_columns(indexed_columns) {
+  if (_indexed_columns.empty()) {
+    throw std::logic_error("AdaptiveRadixTreeIndex needs at least one column.");
+  }
+
+  _row_count = _indexed_columns.front()->size();
+  std::vector<BinaryComparableKey> keys(_row_count);
+  std::vector<bool> is_excluded(_row_count);
+
+  for (const auto& column : _indexed_columns) {
+    if (column->size() != _row_count) {
+      throw std::logic_error("All columns of an AdaptiveRadixTreeIndex must have the same size.");
+    }
+
+    _column_types.push_back(append_column_to_keys(*column, 0, keys, is_excluded));
+  }
+
+  // sort the offsets of all rows without NULLs and NaNs by their keys, the sort is stable so that offsets with the same
+  // key stay in ascending order
+  for (ChunkOffset chunk_offset = 0; chunk_offset < _row_count; ++chunk_offset) {
+    if (!is_excluded[chunk_offset]) _chunk_offsets.push_back(chunk_offset);
+  }
+  std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                   [&](const auto lhs, const auto rhs) { return keys[lhs] < keys[rhs]; });
+
+  // collect each distinct key together with the position of its first offset
+  std::vector<std::pair<BinaryComparableKey, size_t>> distinct_keys;
+  for (size_t position = 0; position < _chunk_offsets.size(); ++position) {
+    auto& key = keys[_chunk_offsets[position]];
+    if (distinct_keys.empty() || distinct_keys.back().first != key) {
+      distinct_keys.emplace_back(std::move(key), position);
+    }
+  }
+
+  if (!distinct_keys.empty()) _root = _build(distinct_keys, 0, distinct_keys.size(), 0);
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _lower_bound(_encode(values));
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  // all keys starting with the encoded values are smaller than the successor of the encoding
+  const auto successor = prefix_successor(_encode(values));
+  if (successor.empty()) return cend();
+  return _lower_bound(successor);
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::cbegin() const { return _chunk_offsets.cbegin(); }
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::cend() const { return _chunk_offsets.cend(); }
+
+size_t AdaptiveRadixTreeIndex::row_count() const { return _row_count; }
+
+std::vector<std::shared_ptr<const BaseColumn>> AdaptiveRadixTreeIndex::indexed_columns() const {
+  return _indexed_columns;
+}
+
+BinaryComparableKey AdaptiveRadixTreeIndex::_encode(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(!values.empty() && values.size() <= _column_types.size(),
+              "AdaptiveRadixTreeIndex expects between one search value and one per indexed column.");
+
+  BinaryComparableKey key;
+  for (size_t index = 0; index < values.size(); ++index) {
+    resolve_data_type(_column_types[index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      append_binary_comparable(key, type_cast<ColumnDataType>(values[index]));
+    });
+  }
+  return key;
+}
+
+AdaptiveRadixTreeIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const BinaryComparableKey& key) const {
+  if (!_root) return cend();
+  return _root->lower_bound(key, 0).value_or(cend());
+}
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_build(
+    const std::vector<std::pair<BinaryComparableKey, size_t>>& keys, const size_t begin, const size_t end,
+    const size_t depth) const {
+  if (end - begin == 1) {
+    return std::make_unique<ARTLeaf>(keys[begin].first, _chunk_offsets.cbegin() + keys[begin].second);
+  }
+
+  // Since the keys are sorted, the bytes shared by the first and the last key are shared by all keys in between. The
+  // keys are prefix-free and distinct, so they are guaranteed to differ before the shorter one ends.
+  const auto& first_key = keys[begin].first;
+  const auto& last_key = keys[end - 1].first;
+  auto split_depth = depth;
+  while (first_key[split_depth] == last_key[split_depth]) ++split_depth;
+
+  ARTChildren children;
+  for (auto child_begin = begin; child_begin < end;) {
+    const auto byte = keys[child_begin].first[split_depth];
+    auto child_end = child_begin + 1;
+    while (child_end < end && keys[child_end].first[split_depth] == byte) ++child_end;
+
+    children.emplace_back(byte, _build(keys, child_begin, child_end, split_depth + 1));
+    child_begin = child_end;
+  }
+
+  BinaryComparableKey prefix(first_key.begin() + depth, first_key.begin() + split_depth);
+  return ARTInnerNode::create(std::move(prefix), std::move(children));
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ARTNode;
+class BaseColumn;
+
+// AdaptiveRadixTreeIndex is an index on one or more columns of any encoding. The values of each row are turned into a
+// BinaryComparableKey, and the keys are stored in an adaptive radix tree (see adaptive_radix_tree_nodes.hpp):
+//
+//  - _chunk_offsets contains the offsets of all rows without NULLs and NaNs, ordered by key (and by offset within the
+//    same key)
+//  - each leaf of the tree holds one distinct key and points to the first of its offsets in _chunk_offsets
+//
+// A lookup descends the tree byte by byte, so its cost depends on the length of the key, not on the number of rows.
+// Search values may cover only the first indexed columns, which finds all rows with that prefix.
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  // throws if no columns are given, if the columns differ in size, or if a column is a ReferenceColumn
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& indexed_columns);
+
+  ~AdaptiveRadixTreeIndex() override;
+
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const final;
+
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const final;
+
+  Iterator cbegin() const final;
+
+  Iterator cend() const final;
+
+  size_t row_count() const final;
+
+  std::vector<std::shared_ptr<const BaseColumn>> indexed_columns() const final;
+
+ protected:
+  // encodes search values using the data types of the indexed columns
+  BinaryComparableKey _encode(const std::vector<AllTypeVariant>& values) const;
+
+  // returns the first offset whose key is >= the given key
+  Iterator _lower_bound(const BinaryComparableKey& key) const;
+
+  // builds the subtree for the sorted, distinct keys in [begin, end), which all share their first `depth` bytes
+  std::unique_ptr<ARTNode> _build(const std::vector<std::pair<BinaryComparableKey, size_t>>& keys, const size_t begin,
+                                  const size_t end, const size_t depth) const;
+
+  const std::vector<std::shared_ptr<const BaseColumn>> _indexed_columns;
+  std::vector<std::string> _column_types;
+  std::vector<ChunkOffset> _chunk_offsets;
+  size_t _row_count;
+  std::unique_ptr<ARTNode> _root;
+};
+
+}  // namespace opossum
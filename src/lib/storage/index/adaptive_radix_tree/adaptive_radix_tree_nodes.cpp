@@ -0,0 +1,109 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTLeaf::ARTLeaf(BinaryComparableKey key, const Iterator begin) : ARTNode(begin), _key(std::move(key)) {}
+
+std::optional<ARTNode::Iterator> ARTLeaf::lower_bound(const BinaryComparableKey& key, const size_t) const {
+  if (_key < key) return std::nullopt;
+  return _begin;
+}
+
+ARTInnerNode::ARTInnerNode(BinaryComparableKey prefix, const Iterator begin)
+    : ARTNode(begin), _prefix(std::move(prefix)) {}
+
+std::optional<ARTNode::Iterator> ARTInnerNode::lower_bound(const BinaryComparableKey& key, size_t depth) const {
+  // if the search key ends or differs within the prefix, either all or none of the keys below are >= the search key
+  for (const auto prefix_byte : _prefix) {
+    if (depth == key.size() || key[depth] < prefix_byte) return _begin;
+    if (key[depth] > prefix_byte) return std::nullopt;
+    ++depth;
+  }
+  if (depth == key.size()) return _begin;
+
+  const auto byte = key[depth];
+  auto [child_byte, child] = _child_at_or_after(byte);
+  if (!child) return std::nullopt;
+
+  if (child_byte == byte) {
+    if (const auto result = child->lower_bound(key, depth + 1)) return result;
+
+    // all keys below the matching child are smaller, so the answer is the smallest key of the next child
+    if (byte == 0xFF) return std::nullopt;
+    std::tie(child_byte, child) = _child_at_or_after(byte + 1);
+    if (!child) return std::nullopt;
+  }
+
+  return child->begin();
+}
+
+std::unique_ptr<ARTNode> ARTInnerNode::create(BinaryComparableKey prefix, ARTChildren children) {
+  DebugAssert(children.size() >= 2, "Inner nodes of an adaptive radix tree need at least two children.");
+  if (children.size() <= 4) return std::make_unique<ARTNode4>(std::move(prefix), std::move(children));
+  if (children.size() <= 16) return std::make_unique<ARTNode16>(std::move(prefix), std::move(children));
+  if (children.size() <= 48) return std::make_unique<ARTNode48>(std::move(prefix), std::move(children));
+  return std::make_unique<ARTNode256>(std::move(prefix), std::move(children));
+}
+
+template <size_t Capacity>
+ARTSortedNode<Capacity>::ARTSortedNode(BinaryComparableKey prefix, ARTChildren children)
+    : ARTInnerNode(std::move(prefix), children.front().second->begin()),
+      _child_count(static_cast<uint8_t>(children.size())) {
+  for (size_t index = 0; index < children.size(); ++index) {
+    _bytes[index] = children[index].first;
+    _children[index] = std::move(children[index].second);
+  }
+}
+
+template <size_t Capacity>
+std::pair<uint8_t, const ARTNode*> ARTSortedNode<Capacity>::_child_at_or_after(const uint8_t byte) const {
+  const auto bytes_end = _bytes.begin() + _child_count;
+  const auto position = std::lower_bound(_bytes.begin(), bytes_end, byte);
+  if (position == bytes_end) return {0, nullptr};
+  return {*position, _children[std::distance(_bytes.begin(), position)].get()};
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+ARTNode48::ARTNode48(BinaryComparableKey prefix, ARTChildren children)
+    : ARTInnerNode(std::move(prefix), children.front().second->begin()) {
+  _child_positions.fill(EMPTY);
+  for (size_t index = 0; index < children.size(); ++index) {
+    _child_positions[children[index].first] = static_cast<uint8_t>(index);
+    _children[index] = std::move(children[index].second);
+  }
+}
+
+std::pair<uint8_t, const ARTNode*> ARTNode48::_child_at_or_after(const uint8_t byte) const {
+  for (auto current = static_cast<size_t>(byte); current < _child_positions.size(); ++current) {
+    if (_child_positions[current] != EMPTY) {
+      return {static_cast<uint8_t>(current), _children[_child_positions[current]].get()};
+    }
+  }
+  return {0, nullptr};
+}
+
+ARTNode256::ARTNode256(BinaryComparableKey prefix, ARTChildren children)
+    : ARTInnerNode(std::move(prefix), children.front().second->begin()) {
+  for (auto& [byte, child] : children) {
+    _children[byte] = std::move(child);
+  }
+}
+
+std::pair<uint8_t, const ARTNode*> ARTNode256::_child_at_or_after(const uint8_t byte) const {
+  for (auto current = static_cast<size_t>(byte); current < _children.size(); ++current) {
+    if (_children[current]) return {static_cast<uint8_t>(current), _children[current].get()};
+  }
+  return {0, nullptr};
+}
+
+}  // namespace opossum
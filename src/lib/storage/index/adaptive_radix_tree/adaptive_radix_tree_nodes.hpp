@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "storage/index/binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The nodes of an AdaptiveRadixTreeIndex (Leis et al., "The Adaptive Radix Tree", ICDE 2013). The tree is built once
+// from the sorted keys of a chunk and is immutable afterwards.
+//
+// Inner nodes branch on one byte of the key. Sequences of bytes that all keys below a node share are stored in the
+// node itself (path compression), and each inner node uses the smallest of four layouts that fits its children:
+// sorted arrays of 4 or 16 bytes, an index of 256 bytes into 48 children, or 256 direct child pointers.
+// Leaves hold a complete key and the range of offsets (in the index's offset vector) of the rows with that key.
+class ARTNode : private Noncopyable {
+ public:
+  using Iterator = BaseIndex::Iterator;
+
+  virtual ~ARTNode() = default;
+
+  // Returns the first offset of the smallest key in this subtree that is >= the search key, or nullopt if all keys in
+  // this subtree are smaller. All keys in this subtree share their first `depth` bytes with the search key.
+  virtual std::optional<Iterator> lower_bound(const BinaryComparableKey& key, const size_t depth) const = 0;
+
+  // returns the first offset of the smallest key in this subtree
+  Iterator begin() const { return _begin; }
+
+ protected:
+  explicit ARTNode(const Iterator begin) : _begin(begin) {}
+
+  const Iterator _begin;
+};
+
+class ARTLeaf final : public ARTNode {
+ public:
+  ARTLeaf(BinaryComparableKey key, const Iterator begin);
+
+  std::optional<Iterator> lower_bound(const BinaryComparableKey& key, const size_t depth) const final;
+
+ protected:
+  const BinaryComparableKey _key;
+};
+
+// the children of an inner node, ordered by the byte they are reached with
+using ARTChildren = std::vector<std::pair<uint8_t, std::unique_ptr<ARTNode>>>;
+
+class ARTInnerNode : public ARTNode {
+ public:
+  std::optional<Iterator> lower_bound(const BinaryComparableKey& key, const size_t depth) const final;
+
+  // creates the smallest inner node that can hold the given children (at least two)
+  static std::unique_ptr<ARTNode> create(BinaryComparableKey prefix, ARTChildren children);
+
+ protected:
+  ARTInnerNode(BinaryComparableKey prefix, const Iterator begin);
+
+  // returns the child with the smallest byte >= the given byte together with that byte, or nullptr
+  virtual std::pair<uint8_t, const ARTNode*> _child_at_or_after(const uint8_t byte) const = 0;
+
+  // the bytes shared by all keys below this node, starting at the depth at which the node is reached
+  const BinaryComparableKey _prefix;
+};
+
+// Node4 and Node16: the bytes of the children are kept in a sorted array
+template <size_t Capacity>
+class ARTSortedNode final : public ARTInnerNode {
+ public:
+  ARTSortedNode(BinaryComparableKey prefix, ARTChildren children);
+
+ protected:
+  std::pair<uint8_t, const ARTNode*> _child_at_or_after(const uint8_t byte) const final;
+
+  uint8_t _child_count;
+  std::array<uint8_t, Capacity> _bytes;
+  std::array<std::unique_ptr<ARTNode>, Capacity> _children;
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+// Node48: each possible byte maps to the position of its child, or to EMPTY
+class ARTNode48 final : public ARTInnerNode {
+ public:
+  ARTNode48(BinaryComparableKey prefix, ARTChildren children);
+
+ protected:
+  static constexpr uint8_t EMPTY = 0xFF;
+
+  std::pair<uint8_t, const ARTNode*> _child_at_or_after(const uint8_t byte) const final;
+
+  std::array<uint8_t, 256> _child_positions;
+  std::array<std::unique_ptr<ARTNode>, 48> _children;
+};
+
+// Node256: one child pointer for each possible byte
+class ARTNode256 final : public ARTInnerNode {
+ public:
+  ARTNode256(BinaryComparableKey prefix, ARTChildren children);
+
+ protected:
+  std::pair<uint8_t, const ARTNode*> _child_at_or_after(const uint8_t byte) const final;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children;
+};
+
+}  // namespace opossum
@@ -0,0 +1,225 @@
+#include "b_plus_tree_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+struct BPlusTreeIndex::Node {
+  explicit Node(const bool is_leaf) : is_leaf(is_leaf) {}
+  virtual ~Node() = default;
+
+  const bool is_leaf;
+};
+
+struct BPlusTreeIndex::LeafNode final : BPlusTreeIndex::Node {
+  LeafNode() : Node(true) {}
+
+  std::vector<Entry> entries;
+
+  // the leaf with the next larger entries, or nullptr for the last leaf
+  LeafNode* next = nullptr;
+};
+
+// separators[index] is the smallest entry of children[index + 1], so the entries of children[index] lie in
+// [separators[index - 1], separators[index])
+struct BPlusTreeIndex::InnerNode final : BPlusTreeIndex::Node {
+  InnerNode() : Node(false) {}
+
+  std::vector<Entry> separators;
+  std::vector<std::unique_ptr<Node>> children;
+};
+
+BPlusTreeIndex::BPlusTreeIndex(const Table& table, const std::vector<ColumnID>& column_ids)
+    : _column_ids(column_ids), _root(std::make_unique<LeafNode>()) {
+  if (_column_ids.empty()) {
+    throw std::logic_error("BPlusTreeIndex needs at least one column.");
+  }
+  for (const auto& column_id : _column_ids) {
+    _column_types.push_back(table.column_type(column_id));
+  }
+}
+
+BPlusTreeIndex::~BPlusTreeIndex() = default;
+
+void BPlusTreeIndex::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin,
+                            const ChunkOffset end) {
+  DebugAssert(begin <= end && end <= chunk.size(), "Rows to index are out of range.");
+
+  // the keys are encoded before the tree is locked
+  std::vector<BinaryComparableKey> keys(end - begin);
+  std::vector<bool> is_excluded(end - begin);
+  for (const auto& column_id : _column_ids) {
+    append_column_to_keys(*chunk.get_column(column_id), begin, keys, is_excluded);
+  }
+
+  // rows with a NULL or NaN in any indexed column have no place in the order of the keys and are left out of the tree,
+  // but count towards size()
+  std::lock_guard<std::shared_mutex> lock(_mutex);
+  for (size_t row = 0; row < keys.size(); ++row) {
+    if (is_excluded[row]) continue;
+    auto split = _insert(*_root, Entry{std::move(keys[row]), RowID{chunk_id, static_cast<ChunkOffset>(begin + row)}});
+    if (split) {
+      // the root was split, so the tree grows by one level
+      auto new_root = std::make_unique<InnerNode>();
+      new_root->separators.push_back(std::move(split->first));
+      new_root->children.push_back(std::move(_root));
+      new_root->children.push_back(std::move(split->second));
+      _root = std::move(new_root);
+    }
+  }
+  _size += keys.size();
+}
+
+std::shared_ptr<PosList> BPlusTreeIndex::scan(const ScanType scan_type,
+                                              const std::vector<AllTypeVariant>& values) const {
+  auto pos_list = std::make_shared<PosList>();
+  scan(scan_type, values, *pos_list);
+  return pos_list;
+}
+
+void BPlusTreeIndex::scan(const ScanType scan_type, const std::vector<AllTypeVariant>& values,
+                          PosList& pos_list) const {
+  DebugAssert(!values.empty() && values.size() <= _column_ids.size(),
+              "BPlusTreeIndex expects between one search value and one per indexed column.");
+
+  BinaryComparableKey key;
+  auto has_nan = false;
+  for (size_t index = 0; index < values.size(); ++index) {
+    resolve_data_type(_column_types[index], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value = type_cast<ColumnDataType>(values[index]);
+      if constexpr (std::is_floating_point<ColumnDataType>::value) {
+        has_nan = has_nan || std::isnan(value);
+      }
+      append_binary_comparable(key, value);
+    });
+  }
+
+  // all keys starting with the search key are smaller than its successor, an empty successor means there is none
+  auto successor = std::optional<BinaryComparableKey>{prefix_successor(key)};
+  if (successor->empty()) successor = std::nullopt;
+
+  const auto begin = pos_list.size();
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  if (has_nan) {
+    // a NaN search value is unequal to all stored keys and matches nothing else
+    if (scan_type == ScanType::OpNotEquals) _append_range({}, std::nullopt, pos_list);
+  } else {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        _append_range(key, successor, pos_list);
+        break;
+      case ScanType::OpNotEquals:
+        _append_range({}, key, pos_list);
+        if (successor) _append_range(*successor, std::nullopt, pos_list);
+        break;
+      case ScanType::OpLessThan:
+        _append_range({}, key, pos_list);
+        break;
+      case ScanType::OpLessThanEquals:
+        _append_range({}, successor, pos_list);
+        break;
+      case ScanType::OpGreaterThan:
+        if (successor) _append_range(*successor, std::nullopt, pos_list);
+        break;
+      case ScanType::OpGreaterThanEquals:
+        _append_range(key, std::nullopt, pos_list);
+        break;
+    }
+  }
+  lock.unlock();
+
+  std::sort(pos_list.begin() + begin, pos_list.end());
+}
+
+const std::vector<ColumnID>& BPlusTreeIndex::column_ids() const { return _column_ids; }
+
+size_t BPlusTreeIndex::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _size;
+}
+
+std::optional<std::pair<BPlusTreeIndex::Entry, std::unique_ptr<BPlusTreeIndex::Node>>> BPlusTreeIndex::_insert(
+    Node& node, Entry entry) {
+  if (node.is_leaf) {
+    auto& leaf = static_cast<LeafNode&>(node);
+    leaf.entries.insert(std::upper_bound(leaf.entries.begin(), leaf.entries.end(), entry), std::move(entry));
+    if (leaf.entries.size() <= NODE_CAPACITY) return std::nullopt;
+
+    // split the leaf in half, the first entry of the new right leaf becomes the separator
+    auto right = std::make_unique<LeafNode>();
+    const auto middle = leaf.entries.begin() + leaf.entries.size() / 2;
+    right->entries.assign(std::make_move_iterator(middle), std::make_move_iterator(leaf.entries.end()));
+    leaf.entries.erase(middle, leaf.entries.end());
+    right->next = leaf.next;
+    leaf.next = right.get();
+
+    auto separator = right->entries.front();
+    return std::make_pair(std::move(separator), std::unique_ptr<Node>(std::move(right)));
+  }
+
+  auto& inner = static_cast<InnerNode&>(node);
+  const auto child = std::upper_bound(inner.separators.begin(), inner.separators.end(), entry);
+  const auto child_index = static_cast<size_t>(std::distance(inner.separators.begin(), child));
+  auto split = _insert(*inner.children[child_index], std::move(entry));
+  if (!split) return std::nullopt;
+
+  inner.separators.insert(inner.separators.begin() + child_index, std::move(split->first));
+  inner.children.insert(inner.children.begin() + child_index + 1, std::move(split->second));
+  if (inner.children.size() <= NODE_CAPACITY) return std::nullopt;
+
+  // split the inner node, the middle separator moves up instead of being kept in either half
+  auto right = std::make_unique<InnerNode>();
+  const auto middle = inner.separators.size() / 2;
+  auto separator = std::move(inner.separators[middle]);
+  right->separators.assign(std::make_move_iterator(inner.separators.begin() + middle + 1),
+                           std::make_move_iterator(inner.separators.end()));
+  right->children.assign(std::make_move_iterator(inner.children.begin() + middle + 1),
+                         std::make_move_iterator(inner.children.end()));
+  inner.separators.erase(inner.separators.begin() + middle, inner.separators.end());
+  inner.children.erase(inner.children.begin() + middle + 1, inner.children.end());
+
+  return std::make_pair(std::move(separator), std::unique_ptr<Node>(std::move(right)));
+}
+
+void BPlusTreeIndex::_append_range(const BinaryComparableKey& lower, const std::optional<BinaryComparableKey>& upper,
+                                   PosList& pos_list) const {
+  const auto key_is_less = [](const Entry& entry, const BinaryComparableKey& key) { return entry.first < key; };
+
+  // Descend to the leftmost leaf that may contain the lower key. Entries of children left of a separator with a
+  // smaller key are all smaller than the lower key, but left of a separator with an equal key, there may be equal keys.
+  const auto* node = _root.get();
+  while (!node->is_leaf) {
+    const auto& inner = static_cast<const InnerNode&>(*node);
+    const auto child = std::lower_bound(inner.separators.begin(), inner.separators.end(), lower, key_is_less);
+    node = inner.children[std::distance(inner.separators.begin(), child)].get();
+  }
+
+  const auto* leaf = static_cast<const LeafNode*>(node);
+  auto entry = std::lower_bound(leaf->entries.begin(), leaf->entries.end(), lower, key_is_less);
+  while (leaf) {
+    for (; entry != leaf->entries.end(); ++entry) {
+      if (upper && entry->first >= *upper) return;
+      pos_list.push_back(entry->second);
+    }
+    leaf = leaf->next;
+    if (leaf) entry = leaf->entries.begin();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+// BPlusTreeIndex is a secondary index on one or more columns of a whole table. Unlike the chunk indexes (see
+// BaseIndex), it maps the values of a row directly to its RowID, so that a lookup does not have to probe every chunk.
+//
+// The values of each row are encoded into a BinaryComparableKey (see binary_comparable_key.hpp) and the pairs of key
+// and RowID are stored in the leaves of a B+-tree, ordered by key and, for equal keys, by RowID. Leaves are linked,
+// so a range query descends the tree once and then walks the leaves from left to right.
+//
+// Table indexes are created through Table::create_table_index and kept up to date as rows are added to the table.
+// Since RowIDs do not change when a chunk is compressed, the index stays valid across compress_chunk.
+// Inserts and lookups may be called concurrently.
+class BPlusTreeIndex : private Noncopyable {
+ public:
+  // maximum number of entries of a leaf and of children of an inner node
+  static constexpr size_t NODE_CAPACITY = 64;
+
+  // creates an empty index on the given columns of the table, rows are added with insert()
+  BPlusTreeIndex(const Table& table, const std::vector<ColumnID>& column_ids);
+
+  ~BPlusTreeIndex();
+
+  // adds the rows [begin, end) of a chunk of the indexed table
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end);
+
+  // Returns the RowIDs of all rows whose values compare to the search values as given by the scan type, sorted by
+  // RowID. If fewer search values than indexed columns are given, only the first columns are compared.
+  // Rows with a NULL or NaN are never returned, also not for OpNotEquals, which NaN satisfies in a plain scan.
+  std::shared_ptr<PosList> scan(const ScanType scan_type, const std::vector<AllTypeVariant>& values) const;
+
+  // same as above, but appends the RowIDs to the given PosList, e.g., to one that lives in the arena of an operator
+  void scan(const ScanType scan_type, const std::vector<AllTypeVariant>& values, PosList& pos_list) const;
+
+  // returns the indexed columns, in the order in which they are compared
+  const std::vector<ColumnID>& column_ids() const;
+
+  // returns the number of indexed rows, including the rows with a NULL or NaN, which are not stored in the tree
+  size_t size() const;
+
+ protected:
+  using Entry = std::pair<BinaryComparableKey, RowID>;
+
+  struct Node;
+  struct LeafNode;
+  struct InnerNode;
+
+  // inserts the entry into the subtree and returns the separator and the new right sibling if the node was split
+  std::optional<std::pair<Entry, std::unique_ptr<Node>>> _insert(Node& node, Entry entry);
+
+  // appends the RowIDs of all entries with lower <= key < upper to the PosList, no upper key means no upper bound
+  void _append_range(const BinaryComparableKey& lower, const std::optional<BinaryComparableKey>& upper,
+                     PosList& pos_list) const;
+
+  const std::vector<ColumnID> _column_ids;
+  std::vector<std::string> _column_types;
+
+  std::unique_ptr<Node> _root;
+  size_t _size = 0;
+
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
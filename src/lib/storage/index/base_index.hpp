@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// BaseIndex is the abstract super class for all indexes on one or more columns of a chunk. An index hands out the
+// offsets of the indexed rows ordered by their values, compared column by column. All rows whose values lie in a range
+// therefore form one consecutive range of offsets, e.g., [lower_bound({x}), upper_bound({x})) for all rows whose first
+// indexed column is equal to x. Rows with a NULL in any indexed column are not handed out, since no predicate holds
+// for them.
+//
+// Indexes are created through Chunk::create_index.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  BaseIndex() = default;
+  virtual ~BaseIndex() = default;
+
+  // Returns an iterator to the first offset whose values are >= the search values. If fewer search values than indexed
+  // columns are given, only the first columns are compared.
+  virtual Iterator lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+
+  // Returns an iterator to the first offset whose values are > the search values. If fewer search values than indexed
+  // columns are given, only the first columns are compared.
+  virtual Iterator upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+
+  // returns iterators to the offset of the smallest value and past the offset of the largest value
+  virtual Iterator cbegin() const = 0;
+  virtual Iterator cend() const = 0;
+
+  // returns the number of rows of the chunk the index was built for, including the rows that are NULL
+  virtual size_t row_count() const = 0;
+
+  // returns the columns the index was built on, in the order in which they are compared
+  virtual std::vector<std::shared_ptr<const BaseColumn>> indexed_columns() const = 0;
+};
+
+}  // namespace opossum
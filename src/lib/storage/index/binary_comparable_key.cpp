@@ -0,0 +1,131 @@
+#include "binary_comparable_key.hpp"
+
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/frame_of_reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// returns true for NaN, which is not ordered with respect to any value
+template <typename T>
+bool is_nan(const T& value) {
+  if constexpr (std::is_floating_point<T>::value) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+// appends the encoding of a value to a key or, for NaN, flags the row as excluded
+template <typename T>
+void append_value_to_key(BinaryComparableKey& key, const T& value, std::vector<bool>::reference is_excluded) {
+  if (is_nan(value)) {
+    is_excluded = true;
+    return;
+  }
+  append_binary_comparable(key, value);
+}
+
+// If the column stores values of type T, appends the encodings of its rows to the keys and returns true.
+template <typename T>
+bool append_typed_column_to_keys(const BaseColumn& column, const ChunkOffset begin,
+                                 std::vector<BinaryComparableKey>& keys, std::vector<bool>& is_excluded) {
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    for (size_t row = 0; row < keys.size(); ++row) {
+      append_value_to_key(keys[row], values[begin + row], is_excluded[row]);
+    }
+    return true;
+  }
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&column)) {
+    const auto& attribute_vector = *dictionary_column->attribute_vector();
+    std::vector<ValueID> value_ids(keys.size());
+    attribute_vector.get_range(begin, value_ids.size(), value_ids.data());
+
+    // NULL rows have no dictionary entry, they are flagged by append_column_to_keys
+    const auto null_value_id = dictionary_column->null_value_id();
+    if (keys.size() < dictionary_column->unique_values_count()) {
+      for (size_t row = 0; row < keys.size(); ++row) {
+        if (value_ids[row] == null_value_id) continue;
+        append_value_to_key(keys[row], T(dictionary_column->value_by_value_id(value_ids[row])), is_excluded[row]);
+      }
+      return true;
+    }
+
+    // for many rows, each dictionary entry is encoded once and its encoding is copied into the keys
+    std::vector<BinaryComparableKey> encoded_values(dictionary_column->unique_values_count());
+    std::vector<bool> is_nan_value_id(encoded_values.size());
+    for (ValueID value_id{0}; value_id < encoded_values.size(); ++value_id) {
+      append_value_to_key(encoded_values[value_id], T(dictionary_column->value_by_value_id(value_id)),
+                          is_nan_value_id[value_id]);
+    }
+    for (size_t row = 0; row < keys.size(); ++row) {
+      if (value_ids[row] == null_value_id) continue;
+      if (is_nan_value_id[value_ids[row]]) {
+        is_excluded[row] = true;
+        continue;
+      }
+      const auto& encoded_value = encoded_values[value_ids[row]];
+      keys[row].insert(keys[row].end(), encoded_value.begin(), encoded_value.end());
+    }
+    return true;
+  }
+
+  if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&column)) {
+    for (size_t row = 0; row < keys.size(); ++row) {
+      append_value_to_key(keys[row], run_length_column->get(begin + row), is_excluded[row]);
+    }
+    return true;
+  }
+
+  if constexpr (std::is_integral<T>::value) {
+    if (const auto frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<T>*>(&column)) {
+      for (size_t row = 0; row < keys.size(); ++row) {
+        append_binary_comparable(keys[row], frame_of_reference_column->get(begin + row));
+      }
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
+std::string append_column_to_keys(const BaseColumn& column, const ChunkOffset begin,
+                                  std::vector<BinaryComparableKey>& keys, std::vector<bool>& is_excluded) {
+  DebugAssert(begin + keys.size() <= column.size(), "Rows to encode are out of range.");
+  DebugAssert(is_excluded.size() == keys.size(), "Expected one exclusion flag per key.");
+
+  if (const auto validity = column.validity()) {
+    for (size_t row = 0; row < keys.size(); ++row) {
+      if (!validity->is_valid(begin + row)) is_excluded[row] = true;
+    }
+  }
+
+  std::string column_type;
+  hana::for_each(column_types, [&](auto column_type_pair) {
+    using ColumnDataType = typename decltype(+hana::second(column_type_pair))::type;
+    if (column_type.empty() && append_typed_column_to_keys<ColumnDataType>(column, begin, keys, is_excluded)) {
+      column_type = hana::first(column_type_pair);
+    }
+  });
+
+  if (column_type.empty()) {
+    throw std::logic_error("Binary-comparable keys cannot be created for this column type.");
+  }
+  return column_type;
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+
+// A BinaryComparableKey is a byte string whose lexicographic (memcmp) order equals the order of the encoded values.
+// Keys of several values are built by appending their encodings, which yields the lexicographic order of the tuples.
+// Radix-based indexes can therefore branch on single bytes without knowing the data types of the indexed columns.
+//
+// No encoded value is a prefix of another encoded value of the same type: numbers have a fixed width, and strings
+// are terminated. Hence, keys of the same column types are prefix-free, too.
+using BinaryComparableKey = std::vector<uint8_t>;
+
+namespace detail {
+
+template <typename UnsignedT>
+void append_big_endian(BinaryComparableKey& key, const UnsignedT value) {
+  for (auto shift = static_cast<int>(sizeof(UnsignedT) * 8) - 8; shift >= 0; shift -= 8) {
+    key.push_back(static_cast<uint8_t>(value >> shift));
+  }
+}
+
+}  // namespace detail
+
+// appends the binary-comparable encoding of a value to the key
+//  - signed integers: the sign bit is flipped, so that negative numbers come first, and the bytes are stored big-endian
+//  - floating point numbers: for positive numbers, the sign bit is flipped, for negative numbers, all bits are
+//    flipped, which reverses their order. -0.0 is encoded as 0.0, which it equals. NaN is not ordered with respect to
+//    any value, so callers leave NaN rows out of the keys, just like NULL rows (see append_column_to_keys).
+//  - strings: 0x00 bytes are escaped as 0x00 0xFF, and the string is terminated by 0x00 0x00
+template <typename T>
+void append_binary_comparable(BinaryComparableKey& key, const T& value) {
+  if constexpr (std::is_integral<T>::value) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    detail::append_big_endian(key, static_cast<UnsignedT>(static_cast<UnsignedT>(value) ^ sign_bit));
+  } else if constexpr (std::is_floating_point<T>::value) {
+    using UnsignedT = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto sign_bit = UnsignedT{1} << (sizeof(T) * 8 - 1);
+    const auto normalized_value = value == 0 ? T{0} : value;
+    UnsignedT bits;
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    detail::append_big_endian(key, static_cast<UnsignedT>((bits & sign_bit) ? ~bits : bits ^ sign_bit));
+  } else {
+    static_assert(std::is_same<T, std::string>::value, "Unsupported type for binary-comparable keys.");
+    for (const auto character : value) {
+      key.push_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.push_back(0xFF);
+    }
+    key.push_back(0x00);
+    key.push_back(0x00);
+  }
+}
+
+// Returns the smallest key that is larger than all keys starting with the given prefix, e.g., to find the end of all
+// keys whose first values equal some search values. Returns an empty key if there is no such key (all bytes are 0xFF).
+inline BinaryComparableKey prefix_successor(BinaryComparableKey prefix) {
+  while (!prefix.empty() && prefix.back() == 0xFF) prefix.pop_back();
+  if (!prefix.empty()) ++prefix.back();
+  return prefix;
+}
+
+// Appends the encodings of the rows [begin, begin + keys.size()) of a column to the keys, one row per key, and
+// returns the data type of the column (e.g., "int"). Throws if the column is neither a value column nor one of the
+// encoded columns, e.g., for ReferenceColumns. Rows that no comparison matches, i.e., NULLs and NaNs, are flagged in
+// is_excluded, which has one entry per key. Their keys are meaningless, callers have to skip these rows.
+std::string append_column_to_keys(const BaseColumn& column, const ChunkOffset begin,
+                                  std::vector<BinaryComparableKey>& keys, std::vector<bool>& is_excluded);
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#include "group_key_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& indexed_columns)
+    : _indexed_column(indexed_columns.size() == 1
+                          ? std::dynamic_pointer_cast<const BaseDictionaryColumn>(indexed_columns.front())
+                          : nullptr) {
+  if (indexed_columns.size() != 1) {
+    throw std::logic_error("GroupKeyIndex can only be created on a single column.");
+  }
+  if (!_indexed_column) {
+    throw std::logic_error("GroupKeyIndex can only be created on a DictionaryColumn.");
+  }
+
+  const auto& attribute_vector = *_indexed_column->attribute_vector();
+  std::vector<ValueID> value_ids(attribute_vector.size());
+  attribute_vector.get_range(0, value_ids.size(), value_ids.data());
+
+  // counting sort of all offsets by value id: count the rows per value id, turn the counts into start positions,
+  // and place each offset at the next free position of its value id
+  _value_id_offsets.assign(_indexed_column->unique_values_count() + 2, 0);
+  for (const auto& value_id : value_ids) {
+    ++_value_id_offsets[value_id + 1];
+  }
+  for (size_t index = 1; index < _value_id_offsets.size(); ++index) {
+    _value_id_offsets[index] += _value_id_offsets[index - 1];
+  }
+
+  _postings.resize(value_ids.size());
+  auto next_positions = _value_id_offsets;
+  for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+    _postings[next_positions[value_ids[chunk_offset]]++] = chunk_offset;
+  }
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == 1, "GroupKeyIndex expects exactly one search value.");
+  return _iterator_for_value_id(_indexed_column->lower_bound(values.front()));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() == 1, "GroupKeyIndex expects exactly one search value.");
+  return _iterator_for_value_id(_indexed_column->upper_bound(values.front()));
+}
+
+GroupKeyIndex::Iterator GroupKeyIndex::cbegin() const { return _postings.cbegin(); }
+
+GroupKeyIndex::Iterator GroupKeyIndex::cend() const {
+  // NaN and NULL rows come last and are not part of the order
+  return _postings.cbegin() + _value_id_offsets[_indexed_column->nan_value_id()];
+}
+
+size_t GroupKeyIndex::row_count() const { return _postings.size(); }
+
+std::vector<std::shared_ptr<const BaseColumn>> GroupKeyIndex::indexed_columns() const { return {_indexed_column}; }
+
+GroupKeyIndex::Iterator GroupKeyIndex::_iterator_for_value_id(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) return cend();
+  return _postings.cbegin() + _value_id_offsets[value_id];
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class BaseDictionaryColumn;
+
+// GroupKeyIndex is an index on a DictionaryColumn. Since the dictionary is sorted, value ids are already in the order
+// of their values and the index only needs to group the offsets of the rows by value id:
+//
+//  - _postings contains all offsets of the chunk, ordered by value id (and by offset within the same value id)
+//  - _value_id_offsets[value_id] is the position in _postings at which the rows of value_id begin, an additional last
+//    entry points to the end of _postings
+//  - NULL rows have the value id after the last dictionary entry, so they form the last group, which lies behind
+//    cend()
+//
+// A lookup is a binary search in the dictionary followed by one access to _value_id_offsets.
+// A GroupKeyIndex covers exactly one column.
+class GroupKeyIndex : public BaseIndex {
+ public:
+  // throws if the column is not a DictionaryColumn
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& indexed_columns);
+
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const final;
+
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const final;
+
+  Iterator cbegin() const final;
+
+  Iterator cend() const final;
+
+  size_t row_count() const final;
+
+  std::vector<std::shared_ptr<const BaseColumn>> indexed_columns() const final;
+
+ protected:
+  // returns an iterator to the first offset of the rows with the given value id, INVALID_VALUE_ID yields cend()
+  Iterator _iterator_for_value_id(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionaryColumn> _indexed_column;
+  std::vector<size_t> _value_id_offsets;
+  std::vector<ChunkOffset> _postings;
+};
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#include "reference_column.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "frame_of_reference_column.hpp"
+#include "resolve_type.hpp"
+#include "run_length_column.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<BaseColumn> materialize_values(const Table& referenced_table, const ColumnID referenced_column_id,
+                                               const PosList& pos_list) {
+  std::vector<T> values(pos_list.size());
+  std::optional<ValidityBitmap> validity;
+  if (referenced_table.column_is_nullable(referenced_column_id)) validity.emplace();
+
+  for (size_t run_begin = 0; run_begin < pos_list.size();) {
+    const auto chunk_id = pos_list[run_begin].chunk_id;
+    auto run_end = run_begin + 1;
+    while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) ++run_end;
+
+    const auto column = referenced_table.get_chunk(chunk_id).get_column(referenced_column_id);
+    const auto copy_run = [&](const auto& get_value) {
+      for (auto index = run_begin; index < run_end; ++index) {
+        const auto chunk_offset = pos_list[index].chunk_offset;
+        const auto is_valid = !column->is_null(chunk_offset);
+        if (is_valid) values[index] = get_value(chunk_offset);
+        if (validity) validity->push_back(is_valid);
+      }
+    };
+
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+      const auto& column_values = value_column->values();
+      copy_run([&](const ChunkOffset chunk_offset) { return column_values[chunk_offset]; });
+    } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
+      copy_run([&](const ChunkOffset chunk_offset) { return dictionary_column->get(chunk_offset); });
+    } else if (const auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(column)) {
+      copy_run([&](const ChunkOffset chunk_offset) { return run_length_column->get(chunk_offset); });
+    } else {
+      auto is_frame_of_reference = false;
+      if constexpr (std::is_integral<T>::value) {
+        if (const auto for_column = std::dynamic_pointer_cast<const FrameOfReferenceColumn<T>>(column)) {
+          copy_run([&](const ChunkOffset chunk_offset) { return for_column->get(chunk_offset); });
+          is_frame_of_reference = true;
+        }
+      }
+      Assert(is_frame_of_reference, "ReferenceColumn refers to a column that cannot be materialized.");
+    }
+    run_begin = run_end;
+  }
+
+  return std::make_shared<ValueColumn<T>>(std::move(values), std::move(validity));
+}
+
+}  // namespace
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {}
+
+const AllTypeVariant ReferenceColumn::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  const auto& row_id = _pos_list->at(i);
+  const auto& chunk = _referenced_table->get_chunk(row_id.chunk_id);
+  return (*chunk.get_column(_referenced_column_id))[row_id.chunk_offset];
+}
+
+size_t ReferenceColumn::size() const { return _pos_list->size(); }
+
+size_t ReferenceColumn::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(PosList) + vector_memory_usage(*_pos_list);
+}
+
+std::string ReferenceColumn::encoding_name() const { return "Reference"; }
+
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+
+const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
+
+ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
+
+std::shared_ptr<BaseColumn> ReferenceColumn::materialize() const {
+  std::shared_ptr<BaseColumn> column;
+  resolve_data_type(_referenced_table->column_type(_referenced_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    column = materialize_values<ColumnDataType>(*_referenced_table, _referenced_column_id, *_pos_list);
+  });
+  return column;
+}
+
+}  // namespace opossum
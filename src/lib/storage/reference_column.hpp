@@ -30,10 +30,23 @@ class ReferenceColumn : public BaseColumn {
 
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
+  std::string encoding_name() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
+
+  // Returns a ValueColumn with the referenced values, in the order of the PosList. Consecutive rows of the same chunk
+  // are copied together, so the type of the referenced column is only resolved once per run.
+  std::shared_ptr<BaseColumn> materialize() const;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const PosList> _pos_list;
 };
 
 }  // namespace opossum
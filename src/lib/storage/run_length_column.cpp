@@ -0,0 +1,161 @@
+#include "run_length_column.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/compare_by_scan_type.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthColumn<T>::RunLengthColumn(const std::shared_ptr<BaseColumn>& base_column) {
+  const auto value_column = dynamic_cast<ValueColumn<T>*>(base_column.get());
+  if (!value_column) {
+    throw std::logic_error("RunLength column could not be initialized due to a type mismatch.");
+  }
+
+  const auto& values = value_column->values();
+  const auto validity = value_column->validity();
+  if (validity) _validity = *validity;
+
+  // NULL rows take the value of the preceding valid row (or of the first valid row, if there is none) so that they
+  // extend a run instead of splitting it. An all-NULL column consists of a single run of T{}.
+  const T* previous_valid_value = nullptr;
+  if (validity) {
+    auto first_valid = size_t{0};
+    while (first_valid < values.size() && !validity->is_valid(first_valid)) ++first_valid;
+    if (first_valid < values.size()) previous_valid_value = &values[first_valid];
+  }
+
+  for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+    const auto is_valid = !validity || validity->is_valid(chunk_offset);
+    if (is_valid) {
+      _zone_map.add(values[chunk_offset]);
+      previous_valid_value = &values[chunk_offset];
+    }
+
+    const auto& value = is_valid || !previous_valid_value ? values[chunk_offset] : *previous_valid_value;
+    if (_values.empty() || value != _values.back()) {
+      if (!_values.empty()) _end_positions.push_back(chunk_offset);
+      _values.push_back(value);
+    }
+  }
+  if (!_values.empty()) _end_positions.push_back(static_cast<ChunkOffset>(values.size()));
+  if (validity) _zone_map.add_nulls(validity->null_count());
+
+  _values.shrink_to_fit();
+  _end_positions.shrink_to_fit();
+}
+
+template <typename T>
+RunLengthColumn<T>::RunLengthColumn(std::vector<T>&& values, std::vector<ChunkOffset>&& end_positions,
+                                    const ZoneMap<T>& zone_map, std::optional<ValidityBitmap> validity)
+    : _zone_map(zone_map),
+      _values(std::move(values)),
+      _end_positions(std::move(end_positions)),
+      _validity(std::move(validity)) {
+  Assert(_values.size() == _end_positions.size(), "Every run of a RunLength column needs a value and an end position.");
+  Assert(!_validity || _validity->size() == size(), "ValidityBitmap does not match the size of the column.");
+  Assert(zone_map.null_count() == 0, "The NULLs of a RunLength column are counted from its ValidityBitmap.");
+  if (_validity) _zone_map.add_nulls(_validity->null_count());
+}
+
+template <typename T>
+const AllTypeVariant RunLengthColumn<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+  if (is_null(i)) return NULL_VALUE;
+  return get(i);
+}
+
+template <typename T>
+const T RunLengthColumn<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "Out of bounds get() on RunLengthColumn.");
+  const auto run = std::upper_bound(_end_positions.begin(), _end_positions.end(), i);
+  return _values[std::distance(_end_positions.begin(), run)];
+}
+
+template <typename T>
+void RunLengthColumn<T>::append(const AllTypeVariant&) {
+  throw std::logic_error("RunLength columns are immutable.");
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::size() const {
+  return _end_positions.empty() ? 0 : _end_positions.back();
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_values) + vector_memory_usage(_end_positions) +
+         (_validity ? _validity->estimate_memory_usage() : 0);
+}
+
+template <typename T>
+std::string RunLengthColumn<T>::encoding_name() const {
+  return "RunLength";
+}
+
+template <typename T>
+const ValidityBitmap* RunLengthColumn<T>::validity() const {
+  return _validity ? &*_validity : nullptr;
+}
+
+template <typename T>
+const std::vector<T>& RunLengthColumn<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+const std::vector<ChunkOffset>& RunLengthColumn<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthColumn<T>::run_count() const {
+  return _values.size();
+}
+
+template <typename T>
+void RunLengthColumn<T>::scan(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+                              PosList& pos_list) const {
+  const auto typed_search_value = type_cast<T>(search_value);
+
+  ChunkOffset run_begin = 0;
+  for (size_t run = 0; run < _values.size(); ++run) {
+    const auto run_end = _end_positions[run];
+    if (compare_by_scan_type(scan_type, _values[run], typed_search_value)) {
+      if (_validity) {
+        _validity->for_each_valid(run_begin, run_end, [&](const size_t chunk_offset) {
+          pos_list.push_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+        });
+      } else {
+        for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+          pos_list.push_back(RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+    run_begin = run_end;
+  }
+}
+
+template <typename T>
+const ZoneMap<T>& RunLengthColumn<T>::zone_map() const {
+  return _zone_map;
+}
+
+template <typename T>
+ZoneMapMatch RunLengthColumn<T>::match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  return _zone_map.match(scan_type, type_cast<T>(search_value));
+}
+
+EXPLICITLY_INSTANTIATE_COLUMN_TYPES(RunLengthColumn);
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "base_column.hpp"
+#include "types.hpp"
+#include "zone_map.hpp"
+
+namespace opossum {
+
+// RunLengthColumn is a specific column type that stores consecutive equal values only once, together with the
+// position at which the run ends. It works well for sorted or clustered data, e.g., tables loaded in timestamp order.
+template <typename T>
+class RunLengthColumn : public BaseColumn {
+ public:
+  /**
+   * Creates a RunLength column from a given value column.
+   */
+  explicit RunLengthColumn(const std::shared_ptr<BaseColumn>& base_column);
+
+  /**
+   * Creates a RunLength column from existing runs, e.g., from a file, see values() and end_positions().
+   * The zone map only covers the valid values, its NULLs are counted from the ValidityBitmap.
+   */
+  RunLengthColumn(std::vector<T>&& values, std::vector<ChunkOffset>&& end_positions, const ZoneMap<T>& zone_map,
+                  std::optional<ValidityBitmap> validity);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position, which must not be NULL. This needs a binary search over the runs.
+  const T get(const size_t i) const;
+
+  // run length columns are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  size_t estimate_memory_usage() const override;
+
+  std::string encoding_name() const override;
+
+  // returns the smallest and the largest value of the column
+  const ZoneMap<T>& zone_map() const;
+
+  ZoneMapMatch match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
+  const ValidityBitmap* validity() const override;
+
+  // returns the value of each run, NULL rows are part of the run of a neighbouring valid row
+  const std::vector<T>& values() const;
+
+  // returns the position after the last row of each run, i.e., run i covers [end_positions[i - 1], end_positions[i])
+  const std::vector<ChunkOffset>& end_positions() const;
+
+  // returns the number of runs
+  size_t run_count() const;
+
+  // Appends the positions of all rows for which `value <scan_type> search_value` holds to the given PosList.
+  // The predicate is evaluated once per run, matching runs are emitted as a whole except for their NULL rows.
+  void scan(const ScanType scan_type, const AllTypeVariant& search_value, const ChunkID chunk_id,
+            PosList& pos_list) const;
+
+ protected:
+  ZoneMap<T> _zone_map;
+  std::vector<T> _values;
+  std::vector<ChunkOffset> _end_positions;
+  std::optional<ValidityBitmap> _validity;
+};
+
+}  // namespace opossum
@@ -1,36 +1,114 @@
 #include "storage_manager.hpp"
 
+#include <charconv>
+#include <filesystem>
+#include <fstream>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
+#include "binary_table.hpp"
+#include "bloom_filter.hpp"
 #include "utils/assert.hpp"
+#include "utils/parallel_for.hpp"
 
 namespace opossum {
 
+namespace {
+
+// The first line of a manifest, followed by the generation of the checkpoint and one line per table with the name of
+// its file and the name of the table, separated by a tab. Each checkpoint writes the files of a new generation, so the
+// files that the current manifest refers to are never overwritten.
+constexpr auto CHECKPOINT_MANIFEST_HEADER = "opossum checkpoint 2";
+
+struct CheckpointManifest {
+  uint64_t generation = 0;
+  // the file name and the table name of each table
+  std::vector<std::pair<std::string, std::string>> tables;
+};
+
+std::filesystem::path checkpoint_manifest_path(const std::filesystem::path& directory) {
+  return directory / "manifest";
+}
+
+std::string checkpoint_table_file_name(const uint64_t generation, const size_t table_index) {
+  return "table_" + std::to_string(generation) + "_" + std::to_string(table_index) + ".bin";
+}
+
+// returns std::nullopt if the directory does not contain a manifest, throws if the manifest is invalid
+std::optional<CheckpointManifest> read_checkpoint_manifest(const std::filesystem::path& directory) {
+  std::ifstream file(checkpoint_manifest_path(directory));
+  if (!file.is_open()) return std::nullopt;
+
+  const auto error_message = "Invalid checkpoint manifest in " + directory.string();
+  std::string line;
+  Assert(std::getline(file, line) && line == CHECKPOINT_MANIFEST_HEADER, error_message);
+
+  CheckpointManifest manifest;
+  Assert(std::getline(file, line), error_message);
+  const auto result = std::from_chars(line.data(), line.data() + line.size(), manifest.generation);
+  Assert(result.ec == std::errc() && result.ptr == line.data() + line.size(), error_message);
+
+  while (std::getline(file, line)) {
+    const auto separator = line.find('\t');
+    Assert(separator != std::string::npos, error_message);
+    auto file_name = line.substr(0, separator);
+    // the tables have to be files within the directory
+    Assert(!file_name.empty() && std::filesystem::path{file_name}.filename() == file_name, error_message);
+    manifest.tables.emplace_back(std::move(file_name), line.substr(separator + 1));
+  }
+  return manifest;
+}
+
+// writes a file under a temporary name and renames it, so that the previous file is replaced atomically
+template <typename Functor>
+void replace_file(const std::filesystem::path& path, const Functor& write_file) {
+  auto temporary_path = path;
+  temporary_path += ".tmp";
+  write_file(temporary_path.string());
+  std::filesystem::rename(temporary_path, path);
+}
+
+}  // namespace
+
+StorageManager::StorageManager() : _tables_mutex(std::make_unique<std::shared_mutex>()) {}
+
 StorageManager& StorageManager::get() {
   static StorageManager instance;
   return instance;
 }
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  DebugAssert(!has_table(name), "Table with name " + name + " already exists.");
+  std::lock_guard<std::shared_mutex> lock(*_tables_mutex);
+  DebugAssert(!_tables.count(name), "Table with name " + name + " already exists.");
   _tables[name] = table;
 }
 
 void StorageManager::drop_table(const std::string& name) {
+  std::lock_guard<std::shared_mutex> lock(*_tables_mutex);
   auto num_erased = _tables.erase(name);
   if (num_erased == 0) {
     DebugAssert(false, "Table with name " + name + " does not exist.");
   }
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const { return _tables.at(name); }
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  return _tables.at(name);
+}
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name) != 0; }
+bool StorageManager::has_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  return _tables.count(name) != 0;
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
   std::vector<std::string> names;
 
   for (const auto& pair : _tables) {
@@ -41,13 +119,126 @@ std::vector<std::string> StorageManager::table_names() const {
 }
 
 void StorageManager::print(std::ostream& out) const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
   for (const auto& pair : _tables) {
     const auto& table_name = pair.first;
     const auto& table = pair.second;
     out << table_name << std::endl
         << "#cols:" << table->col_count() << std::endl
         << "#rows:" << table->row_count() << std::endl
-        << "#chunks:" << table->chunk_count() << std::endl;
+        << "#chunks:" << table->chunk_count() << std::endl
+        << "#bytes:" << table->estimate_memory_usage();
+
+    const auto breakdown = table->estimate_memory_usage_breakdown();
+    for (auto entry = breakdown.begin(); entry != breakdown.end(); ++entry) {
+      out << (entry == breakdown.begin() ? " (" : ", ") << entry->first << ": " << entry->second;
+    }
+    if (!breakdown.empty()) out << ")";
+    out << std::endl;
+
+    // Bloom filters are only built for compressed chunks of tables that opted in
+    auto bloom_filter_count = size_t{0};
+    auto bloom_filter_bytes = size_t{0};
+    auto false_positive_rate_sum = 0.0;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      for (ColumnID column_id{0}; column_id < chunk.col_count(); ++column_id) {
+        const auto bloom_filter = chunk.get_bloom_filter(column_id);
+        if (!bloom_filter) continue;
+        ++bloom_filter_count;
+        bloom_filter_bytes += bloom_filter->memory_usage();
+        false_positive_rate_sum += bloom_filter->false_positive_rate();
+      }
+    }
+    if (bloom_filter_count > 0) {
+      out << "#bloom filters:" << bloom_filter_count << " (" << bloom_filter_bytes << " bytes, "
+          << 100.0 * false_positive_rate_sum / bloom_filter_count << "% false positives)" << std::endl;
+    }
+  }
+}
+
+MemoryUsageBreakdown StorageManager::estimate_memory_usage_breakdown() const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  MemoryUsageBreakdown breakdown;
+  for (const auto& [table_name, table] : _tables) {
+    for (const auto& [name, bytes] : table->estimate_memory_usage_breakdown()) breakdown[name] += bytes;
+  }
+  return breakdown;
+}
+
+size_t StorageManager::estimate_memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  auto bytes = size_t{0};
+  for (const auto& [table_name, table] : _tables) bytes += table->estimate_memory_usage();
+  return bytes;
+}
+
+void StorageManager::checkpoint(const std::string& directory, const uint32_t num_threads) const {
+  const auto directory_path = std::filesystem::path{directory};
+  std::filesystem::create_directories(directory_path);
+
+  std::vector<std::pair<std::string, std::shared_ptr<const Table>>> tables;
+  {
+    std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+    tables.assign(_tables.begin(), _tables.end());
+  }
+  for (const auto& [name, table] : tables) {
+    Assert(name.find('\n') == std::string::npos, "checkpoint: Table names must not contain line breaks.");
+  }
+
+  const auto previous_manifest = read_checkpoint_manifest(directory_path);
+  CheckpointManifest manifest;
+  manifest.generation = previous_manifest ? previous_manifest->generation + 1 : 0;
+  for (size_t table_index = 0; table_index < tables.size(); ++table_index) {
+    const auto& name = tables[table_index].first;
+    manifest.tables.emplace_back(checkpoint_table_file_name(manifest.generation, table_index), name);
+  }
+
+  try {
+    parallel_for(tables.size(), num_threads, [&](size_t table_index) {
+      write_binary_table(*tables[table_index].second, (directory_path / manifest.tables[table_index].first).string());
+    });
+
+    // the manifest replaces the previous one last, so that it only refers to completely written tables
+    replace_file(checkpoint_manifest_path(directory_path), [&](const std::string& file_name) {
+      std::ofstream file(file_name, std::ios::trunc);
+      file << CHECKPOINT_MANIFEST_HEADER << '\n' << manifest.generation << '\n';
+      for (const auto& [table_file_name, name] : manifest.tables) file << table_file_name << '\t' << name << '\n';
+      file.close();
+      Assert(!file.fail(), "checkpoint: Could not write manifest to " + directory);
+    });
+  } catch (...) {
+    // the previous checkpoint stays valid, only the files of this one are removed
+    auto error_code = std::error_code{};
+    for (const auto& [table_file_name, name] : manifest.tables) {
+      std::filesystem::remove(directory_path / table_file_name, error_code);
+    }
+    throw;
+  }
+
+  // tables that were restored from the previous checkpoint keep their mappings of the removed files
+  if (previous_manifest) {
+    for (const auto& [table_file_name, name] : previous_manifest->tables) {
+      std::filesystem::remove(directory_path / table_file_name);
+    }
+  }
+}
+
+void StorageManager::restore(const std::string& directory, const uint32_t num_threads) {
+  const auto directory_path = std::filesystem::path{directory};
+  const auto manifest = read_checkpoint_manifest(directory_path);
+  Assert(manifest.has_value(), "restore: Could not find a checkpoint in " + directory);
+  for (const auto& [file_name, name] : manifest->tables) {
+    Assert(!has_table(name), "restore: Table " + name + " already exists.");
+  }
+
+  std::vector<std::shared_ptr<Table>> tables(manifest->tables.size());
+  parallel_for(tables.size(), num_threads, [&](size_t table_index) {
+    tables[table_index] = map_binary_table((directory_path / manifest->tables[table_index].first).string());
+  });
+
+  for (size_t table_index = 0; table_index < tables.size(); ++table_index) {
+    add_table(manifest->tables[table_index].second, tables[table_index]);
   }
 }
 
@@ -3,7 +3,9 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "storage/table.hpp"
@@ -13,6 +15,7 @@ namespace opossum {
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// Tables can be added, dropped, and looked up concurrently, e.g., while ImportCsv publishes a table that is loading.
 class StorageManager : private Noncopyable {
  public:
   static StorageManager& get();
@@ -32,19 +35,42 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
-  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks)
+  // prints information about all tables in the storage manager (name, #columns, #rows, #chunks, their memory usage by
+  // encoding, and the memory usage and false-positive rate of their Bloom filters)
   void print(std::ostream& out = std::cout) const;
 
+  // returns the estimated memory usage of all tables, see Chunk::estimate_memory_usage_breakdown
+  MemoryUsageBreakdown estimate_memory_usage_breakdown() const;
+
+  // returns the estimated memory usage of all tables in bytes
+  size_t estimate_memory_usage() const;
+
+  // Persists all tables in the given directory, which is created if necessary, using up to num_threads threads. Each
+  // table is written to a file of its own in the binary table format (see write_binary_table), which keeps the
+  // encoding of its chunks, and a manifest lists the files of all tables. Indexes, Bloom filters, and statistics are
+  // not persisted. A checkpoint writes its tables to new files and replaces the manifest last, so a checkpoint that
+  // fails or is interrupted leaves the previous one in the same directory restorable. The files of the previous
+  // checkpoint are deleted afterwards, tables that were restored from them and are still in use keep their mappings.
+  void checkpoint(const std::string& directory, uint32_t num_threads = std::thread::hardware_concurrency()) const;
+
+  // Adds all tables of a checkpoint to the storage manager. The table files are memory-mapped in parallel (see
+  // map_binary_table), so encoded columns are loaded lazily by the page faults of their first accesses instead of being
+  // parsed or re-encoded. Throws if the checkpoint is invalid or one of its tables already exists.
+  void restore(const std::string& directory, uint32_t num_threads = std::thread::hardware_concurrency());
+
   // deletes the entire StorageManager and creates a new one, used especially in tests
   static void reset();
 
   StorageManager(StorageManager&&) = delete;
 
  protected:
-  StorageManager() {}
+  StorageManager();
   StorageManager& operator=(StorageManager&&) = default;
 
   // Implementation goes here
+  // a pointer, so that the StorageManager stays movable for reset()
+  std::unique_ptr<std::shared_mutex> _tables_mutex;
+  // guarded by _tables_mutex
   std::map<std::string, std::shared_ptr<Table>> _tables;
 };
 }  // namespace opossum
@@ -0,0 +1,100 @@
+#include "string_dictionary.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t total_length(const std::vector<std::string>& values) {
+  size_t length = 0;
+  for (const auto& value : values) length += value.size();
+  return length;
+}
+
+}  // namespace
+
+StringDictionary::StringDictionary(const std::vector<std::string>& sorted_values,
+                                   std::pmr::memory_resource* memory_resource)
+    : _data(total_length(sorted_values), memory_resource), _offsets(sorted_values.size() + 1, memory_resource) {
+  DebugAssert(std::adjacent_find(sorted_values.begin(), sorted_values.end(), std::greater_equal<std::string>()) ==
+                  sorted_values.end(),
+              "Values of a StringDictionary have to be sorted and distinct.");
+
+  if (_data.size() > std::numeric_limits<uint32_t>::max()) {
+    throw std::logic_error("Values of a StringDictionary do not fit in 4 GB.");
+  }
+
+  const auto data = _data.mutable_data();
+  const auto offsets = _offsets.mutable_data();
+  uint32_t offset = 0;
+  for (size_t index = 0; index < sorted_values.size(); ++index) {
+    offsets[index] = offset;
+    std::copy(sorted_values[index].begin(), sorted_values[index].end(), data + offset);
+    offset += static_cast<uint32_t>(sorted_values[index].size());
+  }
+  offsets[sorted_values.size()] = offset;
+}
+
+StringDictionary::StringDictionary(ColumnBuffer<char>&& data, ColumnBuffer<uint32_t>&& offsets)
+    : _data(std::move(data)), _offsets(std::move(offsets)) {
+  Assert(!_offsets.empty() && _offsets.back() == _data.size(), "Offsets of a StringDictionary do not match its data.");
+}
+
+std::string_view StringDictionary::operator[](const size_t index) const {
+  return std::string_view{_data.data() + _offsets[index], _offsets[index + 1] - _offsets[index]};
+}
+
+std::string_view StringDictionary::at(const size_t index) const {
+  if (index >= size()) throw std::out_of_range("StringDictionary index out of range.");
+  return (*this)[index];
+}
+
+size_t StringDictionary::size() const { return _offsets.size() - 1; }
+
+size_t StringDictionary::lower_bound(const std::string_view value) const {
+  size_t begin = 0;
+  size_t end = size();
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if ((*this)[middle] < value) {
+      begin = middle + 1;
+    } else {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+size_t StringDictionary::upper_bound(const std::string_view value) const {
+  size_t begin = 0;
+  size_t end = size();
+  while (begin < end) {
+    const auto middle = begin + (end - begin) / 2;
+    if (value < (*this)[middle]) {
+      end = middle;
+    } else {
+      begin = middle + 1;
+    }
+  }
+  return begin;
+}
+
+const ColumnBuffer<char>& StringDictionary::data() const { return _data; }
+
+const ColumnBuffer<uint32_t>& StringDictionary::offsets() const { return _offsets; }
+
+size_t StringDictionary::estimate_memory_usage() const {
+  return sizeof(*this) + _data.estimate_memory_usage() + _offsets.estimate_memory_usage();
+}
+
+}  // namespace opossum
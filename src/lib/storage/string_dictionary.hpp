@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "column_buffer.hpp"
+#include "column_memory_resource.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// StringDictionary is the dictionary of a DictionaryColumn<std::string>. Instead of one std::string per entry, it
+// stores all distinct values back to back in a single buffer and keeps an array of offsets into that buffer.
+// This avoids a heap allocation per long string and keeps binary searches within two contiguous arrays.
+class StringDictionary : private Noncopyable {
+ public:
+  // creates a dictionary from values that are already sorted and distinct, its buffers are allocated from the resource
+  explicit StringDictionary(const std::vector<std::string>& sorted_values,
+                            std::pmr::memory_resource* memory_resource = column_memory_resource());
+
+  // creates a dictionary on top of existing buffers, e.g., in a memory-mapped file, see data() and offsets()
+  StringDictionary(ColumnBuffer<char>&& data, ColumnBuffer<uint32_t>&& offsets);
+
+  // returns the value at a given position, the view is valid as long as the dictionary lives
+  std::string_view operator[](const size_t index) const;
+
+  // same as operator[], but throws std::out_of_range if the index is invalid
+  std::string_view at(const size_t index) const;
+
+  // returns the number of entries
+  size_t size() const;
+
+  // returns the index of the first entry >= value, or size() if there is none
+  size_t lower_bound(const std::string_view value) const;
+
+  // returns the index of the first entry > value, or size() if there is none
+  size_t upper_bound(const std::string_view value) const;
+
+  // returns the concatenated values
+  const ColumnBuffer<char>& data() const;
+
+  // returns the start of each value in data(), followed by the total length of all values
+  const ColumnBuffer<uint32_t>& offsets() const;
+
+  // returns the estimated number of bytes used by the dictionary, including the buffer of values and the offsets
+  size_t estimate_memory_usage() const;
+
+ protected:
+  ColumnBuffer<char> _data;
+  ColumnBuffer<uint32_t> _offsets;
+};
+
+}  // namespace opossum
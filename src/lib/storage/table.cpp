@@ -1,58 +1,105 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <numeric>
+#include <shared_mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "background_compressor.hpp"
+#include "bloom_filter.hpp"
 #include "dictionary_column.hpp"
+#include "frame_of_reference_column.hpp"
+#include "index/b_plus_tree/b_plus_tree_index.hpp"
+#include "run_length_column.hpp"
+#include "table_statistics.hpp"
 #include "value_column.hpp"
 
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/numa.hpp"
+#include "utils/parallel_for.hpp"
 
 namespace opossum {
 
-Table::Table(const uint32_t chunk_size) : _chunk_size(chunk_size) { _chunks.emplace_back(); }
+Table::Table(const uint32_t chunk_size)
+    : _chunks_mutex(std::make_unique<std::shared_mutex>()),
+      _chunk_size(chunk_size),
+      _table_statistics_mutex(std::make_unique<std::mutex>()) {
+  _chunks.push_back(std::make_shared<Chunk>());
+}
+
+Table::~Table() = default;
 
-void Table::add_column_definition(const std::string& name, const std::string& type) {
+Table::Table(Table&&) = default;
+
+void Table::add_column_definition(const std::string& name, const std::string& type, bool nullable) {
   DebugAssert(std::find(_column_names.begin(), _column_names.end(), name) == _column_names.end(),
               "ColumnName already exists");
   _column_names.push_back(name);
   _column_types.push_back(type);
+  _column_nullable.push_back(nullable);
+
+  // the empty first chunk gets the column as well, so that it can adopt the columns of an emplaced chunk
+  if (_chunks.size() == 1 && _chunks.front()->size() == 0 && _chunks.front()->col_count() + 1u == col_count()) {
+    _chunks.front()->add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type, nullable));
+  }
 }
 
-void Table::add_column(const std::string& name, const std::string& type) {
-  add_column_definition(name, type);
+void Table::add_column(const std::string& name, const std::string& type, bool nullable) {
+  add_column_definition(name, type, nullable);
 
   for (auto& chunk : _chunks) {
-    chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type));
+    // the empty first chunk already got the column from add_column_definition
+    if (chunk->col_count() == col_count()) continue;
+    chunk->add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(type, nullable));
   }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  bool newChunk = _chunk_size != 0 && _chunks.back().size() >= _chunk_size;
+  // only the appending thread modifies _chunks, so it can read it without locking
+  bool newChunk = _chunk_size != 0 && _chunks.back()->size() >= _chunk_size;
 
   if (newChunk) {
     create_new_chunk();
   }
 
-  _chunks.back().append(values);
+  _chunks.back()->append(values);
+
+  const auto chunk_offset = _chunks.back()->size() - 1;
+  _index_rows(ChunkID(_chunks.size() - 1), chunk_offset, chunk_offset + 1);
 }
 
 void Table::create_new_chunk() {
-  Chunk chunk;
+  auto chunk = std::make_shared<Chunk>();
+
+  for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+    chunk->add_column(
+        make_shared_by_column_type<BaseColumn, ValueColumn>(_column_types[column_id], _column_nullable[column_id]));
+  }
 
-  for (const auto& column_type : _column_types) {
-    chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(column_type));
+  const auto sealed_chunk_id = ChunkID(_chunks.size() - 1);
+  const auto sealed_chunk_is_full = _chunk_size != 0 && _chunks.back()->size() >= _chunk_size;
+  _place_chunk(*chunk, ChunkID(_chunks.size()));
+
+  {
+    std::lock_guard<std::shared_mutex> lock(*_chunks_mutex);
+    _chunks.push_back(std::move(chunk));
   }
 
-  _chunks.push_back(std::move(chunk));
+  if (_background_compressor && sealed_chunk_is_full) {
+    _background_compressor->enqueue(sealed_chunk_id);
+  }
 }
 
 uint16_t Table::col_count() const { return _column_names.size(); }
@@ -60,14 +107,18 @@ uint16_t Table::col_count() const { return _column_names.size(); }
 uint64_t Table::row_count() const {
   auto count = 0u;
 
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
   for (const auto& chunk : _chunks) {
-    count += chunk.size();
+    count += chunk->size();
   }
 
   return count;
 }
 
-ChunkID Table::chunk_count() const { return ChunkID(_chunks.size()); }
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return ChunkID(_chunks.size());
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   for (auto i = 0u; i < _column_names.size(); ++i) {
@@ -87,28 +138,235 @@ const std::string& Table::column_name(ColumnID column_id) const { return _column
 
 const std::string& Table::column_type(ColumnID column_id) const { return _column_types.at(column_id); }
 
-Chunk& Table::get_chunk(ChunkID chunk_id) { return _chunks.at(chunk_id); }
+bool Table::column_is_nullable(ColumnID column_id) const { return _column_nullable.at(column_id); }
+
+Chunk& Table::get_chunk(ChunkID chunk_id) {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return *_chunks.at(chunk_id);
+}
+
+const Chunk& Table::get_chunk(ChunkID chunk_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  return *_chunks.at(chunk_id);
+}
+
+void Table::compress_chunk(ChunkID chunk_id, EncodingType encoding_type) {
+  DebugAssert(chunk_id < chunk_count(), "Attempting to compress out-of-range chunk.");
+
+  auto& chunk = get_chunk(chunk_id);
+  const auto numa_node = chunk.numa_node();
+  ScopedNumaAffinity affinity(numa_node);
+  for (ColumnID column_id{0}; column_id < col_count(); ++column_id) {
+    // columns are swapped in one by one, so concurrent readers always see a complete chunk
+    _compress_column(chunk, column_id, encoding_type, numa_node);
+  }
+}
+
+std::vector<std::chrono::microseconds> Table::compress_chunks(ChunkID begin, ChunkID end, uint32_t num_threads,
+                                                              EncodingType encoding_type) {
+  DebugAssert(begin <= end && end <= chunk_count(), "Attempting to compress out-of-range chunks.");
+
+  const auto chunk_count = static_cast<size_t>(end - begin);
+  const auto column_count = static_cast<size_t>(col_count());
+  std::vector<std::atomic<int64_t>> encoding_nanoseconds(chunk_count);
+  if (chunk_count == 0 || column_count == 0) return std::vector<std::chrono::microseconds>(chunk_count);
+
+  // Each task encodes every n-th column of one chunk and pins its thread to the chunk's NUMA node only once. With at
+  // least as many chunks as threads, a task covers a whole chunk. Otherwise, the columns of a chunk are split across
+  // several tasks, so that a few wide chunks still keep all threads busy.
+  const auto tasks_per_chunk = std::clamp(size_t{num_threads} / chunk_count, size_t{1}, column_count);
+  parallel_for(chunk_count * tasks_per_chunk, num_threads, [&](size_t task_index) {
+    const auto chunk_index = task_index / tasks_per_chunk;
+    auto& chunk = get_chunk(ChunkID(begin + chunk_index));
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto numa_node = chunk.numa_node();
+    ScopedNumaAffinity affinity(numa_node);
+    for (auto column_index = task_index % tasks_per_chunk; column_index < column_count;
+         column_index += tasks_per_chunk) {
+      _compress_column(chunk, ColumnID(column_index), encoding_type, numa_node);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    encoding_nanoseconds[chunk_index] += std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  });
+
+  std::vector<std::chrono::microseconds> durations;
+  durations.reserve(chunk_count);
+  for (const auto& nanoseconds : encoding_nanoseconds) {
+    durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(nanoseconds)));
+  }
+  return durations;
+}
+
+void Table::enable_background_compression(EncodingType encoding_type) {
+  DebugAssert(_chunk_size != 0, "Background compression requires a maximum chunk size.");
+  DebugAssert(!_background_compressor, "Background compression is already enabled.");
+  _background_compressor = std::make_unique<BackgroundCompressor>(*this, encoding_type);
+}
+
+void Table::enable_bloom_filters(uint32_t bits_per_value) {
+  DebugAssert(bits_per_value > 0, "Bloom filters need at least one bit per value.");
+  _bloom_filter_bits_per_value = bits_per_value;
+}
+
+void Table::set_numa_placement(NumaPlacement numa_placement) {
+  std::lock_guard<std::shared_mutex> lock(*_chunks_mutex);
+  _numa_placement = numa_placement;
+  for (ChunkID chunk_id{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    _place_chunk(*_chunks[chunk_id], chunk_id);
+  }
+}
+
+void Table::_place_chunk(Chunk& chunk, ChunkID chunk_id) const {
+  if (_numa_placement == NumaPlacement::RoundRobin && chunk.numa_node() == UNDEFINED_NODE_ID) {
+    chunk.set_numa_node(NodeID{chunk_id % numa_node_count()});
+  }
+}
+
+void Table::wait_for_background_compression() {
+  if (_background_compressor) _background_compressor->wait_until_idle();
+}
+
+const TableStatistics& Table::table_statistics() const {
+  // Concurrent callers share one instance, which is created under its own lock, so that appends are not blocked. The
+  // statistics read the chunks under the shared lock and refresh themselves under a lock of their own.
+  std::lock_guard<std::mutex> lock(*_table_statistics_mutex);
+  if (!_table_statistics) {
+    _table_statistics = std::make_unique<TableStatistics>(*this);
+  }
+  return *_table_statistics;
+}
+
+void Table::_compress_column(Chunk& chunk, ColumnID column_id, EncodingType encoding_type, NodeID numa_node) {
+  // a column may already have been encoded, e.g., by the background compression, and is kept as it is
+  const auto column = chunk.get_column(column_id);
+  auto is_unencoded = false;
+  resolve_data_type(_column_types[column_id], [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    is_unencoded = std::dynamic_pointer_cast<ValueColumn<ColumnDataType>>(column) != nullptr;
+  });
+  if (!is_unencoded) return;
+
+  const auto memory_resource =
+      numa_node == UNDEFINED_NODE_ID ? column_memory_resource() : numa_memory_resource(numa_node);
+  auto encoded_column = _encode_column(_column_types[column_id], column, encoding_type, memory_resource);
+
+  if (_bloom_filter_bits_per_value != 0) {
+    chunk.set_bloom_filter(column_id, build_bloom_filter(_column_types[column_id], *encoded_column,
+                                                         _bloom_filter_bits_per_value));
+  }
+
+  chunk.replace_column(column_id, std::move(encoded_column));
+}
+
+std::shared_ptr<BaseColumn> Table::_encode_column(const std::string& column_type,
+                                                  const std::shared_ptr<BaseColumn>& column,
+                                                  EncodingType encoding_type,
+                                                  std::pmr::memory_resource* memory_resource) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+      return make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type, column, memory_resource);
+    case EncodingType::RunLength:
+      // RunLengthColumns store few values and are allocated from the global heap
+      return make_shared_by_column_type<BaseColumn, RunLengthColumn>(column_type, column);
+    case EncodingType::FrameOfReference: {
+      // frame of reference encoding only works for integral types whose blocks span at most 32 bits, all other
+      // columns are dictionary-encoded
+      std::shared_ptr<BaseColumn> encoded_column;
+      resolve_data_type(column_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        if constexpr (std::is_integral<ColumnDataType>::value) {
+          if (FrameOfReferenceColumn<ColumnDataType>::is_encodable(column)) {
+            encoded_column = std::make_shared<FrameOfReferenceColumn<ColumnDataType>>(column, memory_resource);
+            return;
+          }
+        }
+        encoded_column = std::make_shared<DictionaryColumn<ColumnDataType>>(column, memory_resource);
+      });
+      return encoded_column;
+    }
+  }
+  Fail("Unknown encoding type.");
+  return nullptr;
+}
+
+void Table::emplace_chunk(Chunk chunk) {
+  DebugAssert(chunk.col_count() == col_count(), "Number of columns of the emplaced chunk does not match.");
+  DebugAssert(_chunk_size == 0 || chunk.size() <= _chunk_size, "Emplaced chunk exceeds the maximum chunk size.");
+
+  const auto is_full = _chunk_size != 0 && chunk.size() >= _chunk_size;
+  ChunkID chunk_id;
+
+  {
+    // the lock is only held to publish the chunk, all rows have been written by the caller beforehand
+    std::lock_guard<std::shared_mutex> lock(*_chunks_mutex);
+    if (_chunks.size() == 1 && _chunks.front()->size() == 0) {
+      // readers may already hold a reference to the empty first chunk, so it is filled instead of replaced
+      _chunks.front()->adopt_columns(std::move(chunk));
+    } else {
+      _chunks.push_back(std::make_shared<Chunk>(std::move(chunk)));
+    }
+    chunk_id = ChunkID(_chunks.size() - 1);
+    _place_chunk(*_chunks.back(), chunk_id);
+  }
+
+  // the chunk is visible before its rows are indexed, which readers detect by comparing the row counts
+  _index_rows(chunk_id, 0, get_chunk(chunk_id).size());
 
-const Chunk& Table::get_chunk(ChunkID chunk_id) const { return _chunks.at(chunk_id); }
+  if (_background_compressor && is_full) {
+    _background_compressor->enqueue(chunk_id);
+  }
+}
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "Attempting to compress out-of-range chunk.");
+std::shared_ptr<const BPlusTreeIndex> Table::create_table_index(const std::vector<ColumnID>& column_ids) {
+  auto table_index = std::make_shared<BPlusTreeIndex>(*this, column_ids);
+
+  std::lock_guard<std::shared_mutex> lock(*_chunks_mutex);
+  for (ChunkID chunk_id{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    table_index->insert(*_chunks[chunk_id], chunk_id, 0, _chunks[chunk_id]->size());
+  }
+  _table_indexes.push_back(table_index);
+  return table_index;
+}
 
-  Chunk chunk;
-  auto& old_chunk = _chunks[chunk_id];
+std::shared_ptr<const BPlusTreeIndex> Table::get_table_index(ColumnID column_id) const {
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_ids().front() == column_id) return table_index;
+  }
+  return nullptr;
+}
 
-  auto id = 0;
-  for (const auto& column_type : _column_types) {
-    chunk.add_column(
-        make_shared_by_column_type<BaseColumn, DictionaryColumn>(column_type, old_chunk.get_column(ColumnID(id))));
-    ++id;
+MemoryUsageBreakdown Table::estimate_memory_usage_breakdown() const {
+  MemoryUsageBreakdown breakdown;
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (const auto& chunk : _chunks) {
+    for (const auto& [name, bytes] : chunk->estimate_memory_usage_breakdown()) breakdown[name] += bytes;
   }
+  return breakdown;
+}
 
-  std::swap(old_chunk, chunk);
+size_t Table::estimate_memory_usage() const {
+  auto bytes = size_t{0};
+  std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+  for (const auto& chunk : _chunks) bytes += chunk->estimate_memory_usage();
+  return bytes;
 }
 
-void emplace_chunk(Chunk chunk) {
-  // Implementation goes here
+void Table::_index_rows(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) {
+  std::vector<std::shared_ptr<BPlusTreeIndex>> table_indexes;
+  std::shared_ptr<const Chunk> chunk;
+  {
+    std::shared_lock<std::shared_mutex> lock(*_chunks_mutex);
+    if (_table_indexes.empty()) return;
+    table_indexes = _table_indexes;
+    chunk = _chunks.at(chunk_id);
+  }
+
+  for (const auto& table_index : table_indexes) {
+    table_index->insert(*chunk, chunk_id, begin, end);
+  }
 }
 
 }  // namespace opossum
@@ -1,14 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <iterator>
 #include <map>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "resolve_type.hpp"
+#include "value_column.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -16,6 +24,8 @@
 
 namespace opossum {
 
+class BackgroundCompressor;
+class BPlusTreeIndex;
 class TableStatistics;
 
 // A table is partitioned horizontally into a number of chunks
@@ -26,9 +36,14 @@ class Table : private Noncopyable {
   // default (0) is an unlimited size. A table holds always at least one chunk
   explicit Table(const uint32_t chunk_size = 0);
 
+  // stops the background compression, if enabled
+  ~Table();
+
   // we need to explicitly set the move constructor to default when
   // we overwrite the copy constructor
-  Table(Table&&) = default;
+  // a table must not be moved once background compression has been enabled
+  // the move constructor is defined in the .cpp, where BackgroundCompressor is a complete type
+  Table(Table&&);
   Table& operator=(Table&&) = default;
 
   // returns the number of columns (cannot exceed ColumnID (uint16_t))
@@ -43,10 +58,16 @@ class Table : private Noncopyable {
   ChunkID chunk_count() const;
 
   // returns the chunk with the given id
+  // the reference stays valid when further chunks are added
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Adds a chunk to the table. If the first chunk is the only one and empty, it adopts the columns of the given chunk
+  // instead (see Chunk::adopt_columns), so references to it stay valid.
+  // This is thread-safe with respect to other calls of emplace_chunk() and to readers, which allows several writers
+  // to fill chunks of their own and publish them when they are done (see TableInserter). It must not be mixed with
+  // concurrent calls of append(), which writes to the last chunk.
+  // A full chunk is queued for background compression if that is enabled.
   void emplace_chunk(Chunk chunk);
 
   // Returns a list of all column names.
@@ -58,6 +79,9 @@ class Table : private Noncopyable {
   // returns the column type of the nth column
   const std::string& column_type(ColumnID column_id) const;
 
+  // returns whether the nth column may contain NULLs
+  bool column_is_nullable(ColumnID column_id) const;
+
   // Returns the column with the given name.
   // This method is intended for debugging purposes only.
   // It does not verify whether a column name is unambiguous.
@@ -69,28 +93,174 @@ class Table : private Noncopyable {
   // adds column definition without creating the actual columns
   // this is helpful when, e.g., an operator first creates the structure of the table
   // and then adds chunk by chunk
-  void add_column_definition(const std::string& name, const std::string& type);
+  // while the table has no rows, the empty first chunk gets an empty ValueColumn, which emplace_chunk() replaces
+  // only nullable columns accept NULL_VALUE, their ValueColumns track NULLs in a ValidityBitmap
+  void add_column_definition(const std::string& name, const std::string& type, bool nullable = false);
 
   // adds a column to the end, i.e., right, of the table
   // the added column should have the same length as existing columns (if any)
-  void add_column(const std::string& name, const std::string& type);
+  void add_column(const std::string& name, const std::string& type, bool nullable = false);
 
   // inserts a row at the end of the table
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
+  // Appends whole columns at once, one vector per column of the table and all of the same length. Values are moved
+  // into the chunks without being converted from or to AllTypeVariants. A new chunk is started whenever the chunk size
+  // is reached. A vector that fits into the current chunk and whose column is still empty is moved in as a whole.
+  //
+  // Example: table.append_columns(std::vector<int32_t>{1, 2, 3}, std::vector<std::string>{"a", "b", "c"});
+  template <typename... ColumnDataTypes>
+  void append_columns(std::vector<ColumnDataTypes>&&... columns);
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueColumn into a DictionaryColumn
-  void compress_chunk(ChunkID chunk_id);
+  // compresses the ValueColumns of a chunk into DictionaryColumns or, e.g., RunLengthColumns for sorted data
+  // columns that are already encoded are skipped
+  // if the chunk is placed on a NUMA node, the encoding runs on that node and allocates its memory there
+  void compress_chunk(ChunkID chunk_id, EncodingType encoding_type = EncodingType::Dictionary);
+
+  // compresses the chunks [begin, end) using up to num_threads threads, encoding chunks and columns in parallel
+  // concurrent readers see each column either in its old or its new form, see Chunk::replace_column
+  // returns the time spent encoding each chunk, summed up over its columns
+  std::vector<std::chrono::microseconds> compress_chunks(ChunkID begin, ChunkID end,
+                                                         uint32_t num_threads = std::thread::hardware_concurrency(),
+                                                         EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Opt-in policy for tables with a maximum chunk size: whenever append() or create_new_chunk() seals a chunk because
+  // it reached the chunk size, the chunk is queued and compressed by a background thread. The encoded columns are
+  // swapped in atomically (see compress_chunk), so appending to the table is never blocked by the compression.
+  void enable_background_compression(EncodingType encoding_type = EncodingType::Dictionary);
+
+  // Opt-in policy: whenever a chunk is compressed from now on, a BlockedBloomFilter is built for each of its columns,
+  // which lets equality scans skip chunks that cannot contain the search value. This is most useful for columns with
+  // many distinct values, where the zone maps of all chunks cover almost the same range.
+  // Must not be called while chunks are being compressed, e.g., by the background compression.
+  void enable_bloom_filters(uint32_t bits_per_value = 10);
+
+  // Sets how chunks are assigned to NUMA nodes. With RoundRobin, the i-th chunk is placed on node i % node count,
+  // which also applies to existing chunks. Chunks that were placed explicitly with Chunk::set_numa_node keep their
+  // node. On single-node hosts, all placements are equivalent to FirstTouch.
+  void set_numa_placement(NumaPlacement numa_placement);
+
+  // blocks until all chunks queued for background compression have been compressed
+  void wait_for_background_compression();
+
+  // returns the statistics of the table, which are created on first use and bring themselves up to date with the
+  // chunks of the table whenever an estimate is requested, see TableStatistics
+  // a table must not be moved once its statistics have been created
+  const TableStatistics& table_statistics() const;
+
+  // Creates a BPlusTreeIndex on the given columns of the whole table, which maps their values to RowIDs. The index
+  // covers all existing rows and is updated by append(), append_columns(), and emplace_chunk(). It must not be
+  // created while rows are being added.
+  std::shared_ptr<const BPlusTreeIndex> create_table_index(const std::vector<ColumnID>& column_ids);
+
+  // returns the table index whose first column is the given column, or nullptr if there is none
+  std::shared_ptr<const BPlusTreeIndex> get_table_index(ColumnID column_id) const;
+
+  // returns the estimated memory usage of all chunks, see Chunk::estimate_memory_usage_breakdown
+  MemoryUsageBreakdown estimate_memory_usage_breakdown() const;
+
+  // returns the estimated memory usage of all chunks in bytes
+  size_t estimate_memory_usage() const;
 
  protected:
+  // creates an encoded copy of a ValueColumn, allocating the encoded data from the given memory resource
+  static std::shared_ptr<BaseColumn> _encode_column(const std::string& column_type,
+                                                    const std::shared_ptr<BaseColumn>& column,
+                                                    EncodingType encoding_type,
+                                                    std::pmr::memory_resource* memory_resource);
+
+  // Replaces a column of a chunk with its encoded version and builds its Bloom filter, if enabled.
+  // The encoded data is allocated on the given NUMA node of the chunk. The caller pins its thread to that node once
+  // per chunk, which keeps reading the ValueColumn and writing the encoded data local.
+  void _compress_column(Chunk& chunk, ColumnID column_id, EncodingType encoding_type, NodeID numa_node);
+
+  // helpers for append_columns, append the rows [begin, end) of each column to the last chunk
+  template <size_t... ColumnIndices, typename... ColumnDataTypes>
+  void _append_column_slices(std::index_sequence<ColumnIndices...>, size_t begin, size_t end,
+                             std::vector<ColumnDataTypes>&... columns);
+
+  // assigns a NUMA node to a chunk according to the placement policy
+  void _place_chunk(Chunk& chunk, ChunkID chunk_id) const;
+
+  // adds the rows [begin, end) of a chunk to all table indexes
+  void _index_rows(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end);
+
+  template <typename T>
+  static void _append_column_slice(BaseColumn& column, std::vector<T>& values, size_t begin, size_t end);
+
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
+  std::vector<bool> _column_nullable;
+
+  // chunks are held by pointer so that references to them stay valid when _chunks grows
+  std::vector<std::shared_ptr<Chunk>> _chunks;
 
-  std::vector<Chunk> _chunks;
+  // guards the structure of _chunks (not the chunks themselves) against concurrent growth
+  // held by pointer to keep the table movable
+  std::unique_ptr<std::shared_mutex> _chunks_mutex;
 
   const uint32_t _chunk_size;
+
+  std::unique_ptr<BackgroundCompressor> _background_compressor;
+
+  // 0 if no Bloom filters are built, see enable_bloom_filters()
+  uint32_t _bloom_filter_bits_per_value = 0;
+
+  NumaPlacement _numa_placement = NumaPlacement::FirstTouch;
+
+  // guarded by _chunks_mutex
+  std::vector<std::shared_ptr<BPlusTreeIndex>> _table_indexes;
+
+  // created lazily by table_statistics(), guarded by _table_statistics_mutex
+  mutable std::unique_ptr<TableStatistics> _table_statistics;
+  std::unique_ptr<std::mutex> _table_statistics_mutex;
 };
+
+template <typename... ColumnDataTypes>
+void Table::append_columns(std::vector<ColumnDataTypes>&&... columns) {
+  static_assert(sizeof...(ColumnDataTypes) > 0, "At least one column has to be appended.");
+  Assert(sizeof...(ColumnDataTypes) == col_count(), "Number of appended columns does not match.");
+  Assert(_column_types == std::vector<std::string>{type_string_of<ColumnDataTypes>()...},
+         "Types of appended columns do not match.");
+
+  const auto row_counts = {columns.size()...};
+  const auto row_count = *row_counts.begin();
+  Assert(std::all_of(row_counts.begin(), row_counts.end(), [&](size_t count) { return count == row_count; }),
+         "Appended columns have different lengths.");
+
+  size_t begin = 0;
+  while (begin < row_count) {
+    if (_chunk_size != 0 && _chunks.back()->size() >= _chunk_size) create_new_chunk();
+
+    const auto free_rows = _chunk_size == 0 ? row_count - begin : _chunk_size - _chunks.back()->size();
+    const auto end = begin + std::min(free_rows, row_count - begin);
+    const auto chunk_id = ChunkID(_chunks.size() - 1);
+    const auto chunk_begin = _chunks.back()->size();
+    _append_column_slices(std::index_sequence_for<ColumnDataTypes...>{}, begin, end, columns...);
+    _index_rows(chunk_id, chunk_begin, _chunks.back()->size());
+    begin = end;
+  }
+}
+
+template <size_t... ColumnIndices, typename... ColumnDataTypes>
+void Table::_append_column_slices(std::index_sequence<ColumnIndices...>, size_t begin, size_t end,
+                                  std::vector<ColumnDataTypes>&... columns) {
+  auto& chunk = *_chunks.back();
+  (_append_column_slice(*chunk.get_column(ColumnID(ColumnIndices)), columns, begin, end), ...);
+}
+
+template <typename T>
+void Table::_append_column_slice(BaseColumn& column, std::vector<T>& values, size_t begin, size_t end) {
+  auto& value_column = dynamic_cast<ValueColumn<T>&>(column);
+  if (begin == 0 && end == values.size()) {
+    value_column.append_batch(std::move(values));
+  } else {
+    value_column.append_batch(
+        std::vector<T>(std::make_move_iterator(values.begin() + begin), std::make_move_iterator(values.begin() + end)));
+  }
+}
 }  // namespace opossum
@@ -0,0 +1,49 @@
+#include "table_inserter.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "table.hpp"
+#include "value_column.hpp"
+
+namespace opossum {
+
+TableInserter::TableInserter(Table& table) : _table(table), _chunk(_create_chunk()) {}
+
+TableInserter::~TableInserter() {
+  // an exception must not escape the destructor, so rows that cannot be published are dropped
+  try {
+    flush();
+  } catch (...) {
+  }
+}
+
+void TableInserter::append(const std::vector<AllTypeVariant>& values) {
+  _chunk.append(values);
+
+  if (_table.chunk_size() != 0 && _chunk.size() >= _table.chunk_size()) {
+    flush();
+  }
+}
+
+void TableInserter::flush() {
+  if (_chunk.size() == 0) return;
+
+  _table.emplace_chunk(std::move(_chunk));
+  _chunk = _create_chunk();
+}
+
+uint32_t TableInserter::pending_row_count() const { return _chunk.size(); }
+
+Chunk TableInserter::_create_chunk() const {
+  Chunk chunk;
+  for (ColumnID column_id{0}; column_id < _table.col_count(); ++column_id) {
+    chunk.add_column(make_shared_by_column_type<BaseColumn, ValueColumn>(_table.column_type(column_id),
+                                                                          _table.column_is_nullable(column_id)));
+  }
+  return chunk;
+}
+
+}  // namespace opossum
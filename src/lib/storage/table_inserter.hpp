@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// A TableInserter appends rows to a table and is meant to be used by a single writer thread. Rows are collected in a
+// chunk that only this inserter can see. Once the chunk reaches the table's chunk size (or flush() is called), it is
+// handed over to Table::emplace_chunk. Any number of inserters can therefore write to the same table in parallel and
+// they only synchronize for the short moment in which a finished chunk is published.
+//
+// Rows become visible to readers chunk by chunk, i.e., not before their chunk is full or flushed.
+class TableInserter : private Noncopyable {
+ public:
+  explicit TableInserter(Table& table);
+
+  // publishes all remaining rows, if this fails, the rows are dropped silently
+  // call flush() beforehand to get notified of errors
+  ~TableInserter();
+
+  // adds a row, given as a list of values
+  void append(const std::vector<AllTypeVariant>& values);
+
+  // publishes the rows that have been appended so far, even if they do not fill a whole chunk
+  void flush();
+
+  // returns the number of rows that have been appended but not published yet
+  uint32_t pending_row_count() const;
+
+ protected:
+  // creates a chunk with an empty ValueColumn for each column of the table
+  Chunk _create_chunk() const;
+
+  Table& _table;
+  Chunk _chunk;
+};
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "table_statistics.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "table.hpp"
+
+namespace opossum {
+
+TableStatistics::TableStatistics(const Table& table) : _table(table) {}
+
+float TableStatistics::estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                                            const AllTypeVariant& search_value) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _refreshed_column_statistics(column_id).estimate_selectivity(scan_type, search_value);
+}
+
+float TableStatistics::estimate_row_count(const ColumnID column_id, const ScanType scan_type,
+                                          const AllTypeVariant& search_value) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto& column_statistics = _refreshed_column_statistics(column_id);
+  return column_statistics.row_count() * column_statistics.estimate_selectivity(scan_type, search_value);
+}
+
+float TableStatistics::estimate_distinct_count(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _refreshed_column_statistics(column_id).estimate_distinct_count();
+}
+
+float TableStatistics::null_fraction(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _refreshed_column_statistics(column_id).null_fraction();
+}
+
+float TableStatistics::nan_fraction(const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _refreshed_column_statistics(column_id).nan_fraction();
+}
+
+const BaseColumnStatistics& TableStatistics::_refreshed_column_statistics(const ColumnID column_id) const {
+  DebugAssert(column_id < _table.col_count(), "Column does not exist.");
+  if (_column_statistics.size() < _table.col_count()) _column_statistics.resize(_table.col_count());
+
+  auto& column_statistics = _column_statistics[column_id];
+  if (!column_statistics) {
+    column_statistics =
+        make_unique_by_column_type<BaseColumnStatistics, ColumnStatistics>(_table.column_type(column_id));
+  }
+
+  auto has_changed = false;
+  const auto chunk_count = _table.chunk_count();
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = _table.get_chunk(chunk_id);
+    has_changed |= column_statistics->refresh_chunk(chunk_id, chunk.get_column(column_id));
+  }
+  if (has_changed) column_statistics->rebuild_histogram();
+
+  return *column_statistics;
+}
+
+}  // namespace opossum
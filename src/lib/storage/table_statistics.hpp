@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "column_statistics.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// TableStatistics estimates how many rows of a table satisfy a predicate, e.g., to order scans or to size hash tables
+// before they are filled. It keeps a ColumnStatistics object per column.
+//
+// Statistics are refreshed incrementally and lazily: whenever an estimate is requested for a column, only the chunks
+// that were added, grew, or were compressed since the last request are summarized again. Estimates must not be
+// requested while rows are appended to the table.
+class TableStatistics : private Noncopyable {
+ public:
+  explicit TableStatistics(const Table& table);
+
+  // returns the estimated fraction of rows for which `value <scan_type> search_value` holds, between 0 and 1
+  float estimate_selectivity(const ColumnID column_id, const ScanType scan_type,
+                             const AllTypeVariant& search_value) const;
+
+  // returns the estimated number of rows for which `value <scan_type> search_value` holds
+  float estimate_row_count(const ColumnID column_id, const ScanType scan_type,
+                           const AllTypeVariant& search_value) const;
+
+  // returns the estimated number of distinct values in a column, NULL is not counted
+  float estimate_distinct_count(const ColumnID column_id) const;
+
+  // returns the fraction of rows of a column that are NULL
+  float null_fraction(const ColumnID column_id) const;
+
+  // returns the fraction of rows of a floating-point column that are NaN
+  float nan_fraction(const ColumnID column_id) const;
+
+ protected:
+  // brings the statistics of a column up to date with the chunks of the table, the mutex has to be held
+  const BaseColumnStatistics& _refreshed_column_statistics(const ColumnID column_id) const;
+
+  const Table& _table;
+
+  mutable std::mutex _mutex;
+  mutable std::vector<std::unique_ptr<BaseColumnStatistics>> _column_statistics;
+};
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include "validity_bitmap.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace opossum {
+
+ValidityBitmap::ValidityBitmap(const size_t size, const bool valid) { append(size, valid); }
+
+ValidityBitmap::ValidityBitmap(std::vector<uint64_t>&& words, const size_t size)
+    : _words(std::move(words)), _size(size) {
+  Assert(_words.size() == (size + 63) / 64, "Number of words does not match the size of the ValidityBitmap.");
+}
+
+void ValidityBitmap::append(const size_t count, const bool valid) {
+  const auto new_size = _size + count;
+  _words.resize((new_size + 63) / 64, 0);
+
+  if (valid) {
+    // set the bits in [_size, new_size) word by word
+    for (auto position = _size; position < new_size;) {
+      const auto bit = position % 64;
+      const auto bit_count = std::min<size_t>(64 - bit, new_size - position);
+      const auto mask = bit_count == 64 ? ~uint64_t{0} : ((uint64_t{1} << bit_count) - 1) << bit;
+      _words[position / 64] |= mask;
+      position += bit_count;
+    }
+  }
+  _size = new_size;
+}
+
+void ValidityBitmap::push_back(const bool valid) {
+  if (_size % 64 == 0) _words.push_back(0);
+  _words.back() |= uint64_t{valid} << (_size % 64);
+  ++_size;
+}
+
+size_t ValidityBitmap::size() const { return _size; }
+
+size_t ValidityBitmap::null_count() const {
+  size_t valid_count = 0;
+  for (const auto word : _words) valid_count += __builtin_popcountll(word);
+  return _size - valid_count;
+}
+
+size_t ValidityBitmap::estimate_memory_usage() const { return vector_memory_usage(_words); }
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// ValidityBitmap marks which rows of a nullable column hold a value (bit set) and which ones are NULL (bit cleared).
+// Bits are packed into 64-bit words, row i is bit i % 64 of word i / 64. Unused bits of the last word are cleared.
+//
+// Scans combine the matches of 64 rows into one word and remove the NULLs with a single AND, see for_each_valid.
+class ValidityBitmap {
+ public:
+  ValidityBitmap() = default;
+
+  // creates a bitmap of `size` rows that are all valid or all NULL
+  explicit ValidityBitmap(const size_t size, const bool valid = true);
+
+  // creates a bitmap of `size` rows from its words, see word()
+  ValidityBitmap(std::vector<uint64_t>&& words, const size_t size);
+
+  // adds `count` rows at the end
+  void append(const size_t count, const bool valid);
+
+  void push_back(const bool valid);
+
+  bool is_valid(const size_t i) const { return (_words[i / 64] >> (i % 64)) & 1; }
+
+  size_t size() const;
+
+  // returns the number of rows that are NULL
+  size_t null_count() const;
+
+  // returns the number of bytes allocated for the bits, the bitmap object itself is not included
+  size_t estimate_memory_usage() const;
+
+  // returns the word that holds the bits of the rows [64 * word_index, 64 * word_index + 64)
+  uint64_t word(const size_t word_index) const { return _words[word_index]; }
+
+  // returns all words, i.e., (size() + 63) / 64 of them
+  const std::vector<uint64_t>& words() const { return _words; }
+
+  // calls function(i) for each valid row i in [begin, end), in ascending order
+  template <typename Function>
+  void for_each_valid(const size_t begin, const size_t end, const Function& function) const {
+    for (auto word_begin = begin - begin % 64; word_begin < end; word_begin += 64) {
+      auto bits = _words[word_begin / 64];
+      if (word_begin < begin) bits &= ~uint64_t{0} << (begin - word_begin);
+      if (end - word_begin < 64) bits &= (uint64_t{1} << (end - word_begin)) - 1;
+
+      for_each_set_bit(bits, word_begin, function);
+    }
+  }
+
+  // calls function(offset + i) for each set bit i of the word, in ascending order. Scans use this to emit the matches
+  // of 64 rows after combining them with the corresponding word of the bitmap.
+  template <typename Function>
+  static void for_each_set_bit(uint64_t bits, const size_t offset, const Function& function) {
+    while (bits) {
+      function(offset + __builtin_ctzll(bits));
+      bits &= bits - 1;
+    }
+  }
+
+ protected:
+  std::vector<uint64_t> _words;
+  size_t _size = 0;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "value_column.hpp"
 
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -9,19 +10,59 @@
 
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_usage.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueColumn<T>::ValueColumn(const bool nullable) {
+  if (nullable) _validity.emplace();
+}
+
+template <typename T>
+ValueColumn<T>::ValueColumn(std::vector<T>&& values, std::optional<ValidityBitmap> validity)
+    : _data(std::move(values)), _validity(std::move(validity)) {
+  if (_validity) {
+    Assert(_validity->size() == _data.size(), "ValidityBitmap does not match the number of values.");
+    _validity->for_each_valid(0, _data.size(), [&](const size_t index) { _zone_map.add(_data[index]); });
+    _zone_map.add_nulls(_validity->null_count());
+  } else {
+    _zone_map.add(_data.begin(), _data.end());
+  }
+}
+
 template <typename T>
 const AllTypeVariant ValueColumn<T>::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
+  if (_validity && !_validity->is_valid(i)) return NULL_VALUE;
   return _data.at(i);
 }
 
 template <typename T>
 void ValueColumn<T>::append(const AllTypeVariant& val) {
+  if (variant_is_null(val)) {
+    if (!_validity) throw std::logic_error("Cannot append NULL to a column that is not nullable.");
+    _data.emplace_back();
+    _validity->push_back(false);
+    _zone_map.add_nulls(1);
+    return;
+  }
+
   _data.push_back(type_cast<T>(val));
+  _zone_map.add(_data.back());
+  if (_validity) _validity->push_back(true);
+}
+
+template <typename T>
+void ValueColumn<T>::append_batch(std::vector<T>&& values) {
+  _zone_map.add(values.begin(), values.end());
+  if (_validity) _validity->append(values.size(), true);
+  if (_data.empty()) {
+    _data = std::move(values);
+  } else {
+    _data.insert(_data.end(), std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+  }
 }
 
 template <typename T>
@@ -29,11 +70,41 @@ size_t ValueColumn<T>::size() const {
   return _data.size();
 }
 
+template <typename T>
+size_t ValueColumn<T>::estimate_memory_usage() const {
+  return sizeof(*this) + vector_memory_usage(_data) + (_validity ? _validity->estimate_memory_usage() : 0);
+}
+
+template <typename T>
+std::string ValueColumn<T>::encoding_name() const {
+  return "Unencoded";
+}
+
 template <typename T>
 const std::vector<T>& ValueColumn<T>::values() const {
   return _data;
 }
 
+template <typename T>
+bool ValueColumn<T>::is_nullable() const {
+  return _validity.has_value();
+}
+
+template <typename T>
+const ValidityBitmap* ValueColumn<T>::validity() const {
+  return _validity ? &*_validity : nullptr;
+}
+
+template <typename T>
+const ZoneMap<T>& ValueColumn<T>::zone_map() const {
+  return _zone_map;
+}
+
+template <typename T>
+ZoneMapMatch ValueColumn<T>::match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const {
+  return _zone_map.match(scan_type, type_cast<T>(search_value));
+}
+
 EXPLICITLY_INSTANTIATE_COLUMN_TYPES(ValueColumn);
 
 }  // namespace opossum
@@ -1,35 +1,62 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
 // ValueColumn is a specific column type that stores all its values in a vector
+// A nullable ValueColumn additionally keeps a ValidityBitmap. NULL rows hold a default-constructed value in the vector.
 template <typename T>
 class ValueColumn : public BaseColumn {
  public:
+  explicit ValueColumn(const bool nullable = false);
+
+  // creates a column that holds the given values, it is nullable if a ValidityBitmap is given
+  explicit ValueColumn(std::vector<T>&& values, std::optional<ValidityBitmap> validity = std::nullopt);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t i) const override;
 
-  // add a value to the end
+  // add a value to the end, throws when appending NULL to a column that is not nullable
   void append(const AllTypeVariant& val) override;
 
+  // add many values to the end at once, without converting them from AllTypeVariants
+  // if the column is empty, the vector is moved in as a whole
+  void append_batch(std::vector<T>&& values);
+
+  bool is_nullable() const;
+
+  const ValidityBitmap* validity() const override;
+
   // return the number of entries
   size_t size() const override;
 
+  size_t estimate_memory_usage() const override;
+
+  std::string encoding_name() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
   const std::vector<T>& values() const;
 
+  // returns the smallest and the largest value appended so far, NULLs are ignored
+  const ZoneMap<T>& zone_map() const;
+
+  ZoneMapMatch match_zone_map(const ScanType scan_type, const AllTypeVariant& search_value) const override;
+
  protected:
   // Implementation goes here
   std::vector<T> _data;
+  ZoneMap<T> _zone_map;
+  std::optional<ValidityBitmap> _validity;
 };
 
 }  // namespace opossum
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// the result of checking a predicate against a ZoneMap
+enum class ZoneMapMatch {
+  None,      // no value of the column can satisfy the predicate
+  Partial,   // some values might satisfy the predicate, each of them has to be checked
+  AllValid,  // all values of the column satisfy the predicate, its NULL rows do not
+  All        // all rows of the column satisfy the predicate, there are no NULLs
+};
+
+// ZoneMap keeps track of the smallest and the largest value of a column. Scans use it to skip columns in which no value
+// can match a predicate, and to emit columns in which all values match without looking at a single one of them.
+// NaNs are not ordered and therefore not part of [min, max], a ZoneMap only remembers that it has seen one.
+// NULLs are only counted, so that columns without NULLs can be emitted without looking at their ValidityBitmap.
+template <typename T>
+class ZoneMap {
+ public:
+  // extends the range so that it covers the given value
+  void add(const T& value) {
+    if constexpr (std::is_floating_point<T>::value) {
+      if (std::isnan(value)) {
+        _has_nan = true;
+        return;
+      }
+    }
+
+    if (_is_empty) {
+      _min = value;
+      _max = value;
+      _is_empty = false;
+    } else if (value < _min) {
+      _min = value;
+    } else if (_max < value) {
+      _max = value;
+    }
+  }
+
+  template <typename Iterator>
+  void add(Iterator begin, Iterator end) {
+    for (auto it = begin; it != end; ++it) add(*it);
+  }
+
+  void add_nulls(const size_t count) { _null_count += count; }
+
+  // true if no value other than NaN has been added
+  bool is_empty() const { return _is_empty; }
+
+  bool has_nan() const { return _has_nan; }
+
+  size_t null_count() const { return _null_count; }
+
+  const T& min() const {
+    DebugAssert(!_is_empty, "Empty ZoneMap has no minimum.");
+    return _min;
+  }
+
+  const T& max() const {
+    DebugAssert(!_is_empty, "Empty ZoneMap has no maximum.");
+    return _max;
+  }
+
+  // checks which values satisfy `value <scan_type> search_value`, a column of NULLs only never matches
+  ZoneMapMatch match(const ScanType scan_type, const T& search_value) const {
+    const auto range_match = _match_nan(scan_type, _match_range(scan_type, search_value));
+    if (range_match == ZoneMapMatch::All && _null_count > 0) return ZoneMapMatch::AllValid;
+    return range_match;
+  }
+
+ protected:
+  // NaN fails every comparison but OpNotEquals, which it passes, so NaNs can disagree with the values in [min, max]
+  ZoneMapMatch _match_nan(const ScanType scan_type, const ZoneMapMatch range_match) const {
+    if (!_has_nan) return range_match;
+    if (range_match == ZoneMapMatch::All) return ZoneMapMatch::Partial;
+    if (scan_type == ScanType::OpNotEquals) return ZoneMapMatch::Partial;
+    return range_match;
+  }
+
+  // checks which values in [min, max] satisfy `value <scan_type> search_value`
+  ZoneMapMatch _match_range(const ScanType scan_type, const T& search_value) const {
+    if (_is_empty) return ZoneMapMatch::None;
+
+    const auto all_equal = !(_min < _max);
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        if (search_value < _min || _max < search_value) return ZoneMapMatch::None;
+        return all_equal ? ZoneMapMatch::All : ZoneMapMatch::Partial;
+      case ScanType::OpNotEquals:
+        if (search_value < _min || _max < search_value) return ZoneMapMatch::All;
+        return all_equal ? ZoneMapMatch::None : ZoneMapMatch::Partial;
+      case ScanType::OpLessThan:
+        if (_max < search_value) return ZoneMapMatch::All;
+        return _min < search_value ? ZoneMapMatch::Partial : ZoneMapMatch::None;
+      case ScanType::OpLessThanEquals:
+        if (!(search_value < _max)) return ZoneMapMatch::All;
+        return search_value < _min ? ZoneMapMatch::None : ZoneMapMatch::Partial;
+      case ScanType::OpGreaterThan:
+        if (search_value < _min) return ZoneMapMatch::All;
+        return search_value < _max ? ZoneMapMatch::Partial : ZoneMapMatch::None;
+      case ScanType::OpGreaterThanEquals:
+        if (!(_min < search_value)) return ZoneMapMatch::All;
+        return _max < search_value ? ZoneMapMatch::None : ZoneMapMatch::Partial;
+    }
+    Fail("Unknown scan type.");
+    return ZoneMapMatch::Partial;
+  }
+
+  bool _is_empty = true;
+  bool _has_nan = false;
+  size_t _null_count = 0;
+  T _min{};
+  T _max{};
+};
+
+}  // namespace opossum
@@ -29,16 +29,17 @@ constexpr auto index_of(Sequence const& sequence, T const& element) {
 // Retrieves the value stored in an AllTypeVariant without conversion
 template <typename T>
 const T& get(const AllTypeVariant& value) {
-  static_assert(hana::contains(types, hana::type_c<T>), "Type not in AllTypeVariant");
+  static_assert(hana::contains(types_including_null, hana::type_c<T>), "Type not in AllTypeVariant");
   return boost::get<T>(value);
 }
 
 // cast methods - from variant to specific type
+// NULL has no value of any type, callers have to check for it with variant_is_null() before casting
 
 // Template specialization for everything but integral types
 template <typename T>
 std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types_including_null, hana::type_c<T>)) return get<T>(value);
 
   return boost::lexical_cast<T>(value);
 }
@@ -46,7 +47,7 @@ std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
 // Template specialization for integral types
 template <typename T>
 std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  if (value.which() == detail::index_of(types_including_null, hana::type_c<T>)) return get<T>(value);
 
   try {
     return boost::lexical_cast<T>(value);
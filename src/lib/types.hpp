@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -31,6 +32,7 @@
 STRONG_TYPEDEF(uint32_t, ChunkID);
 STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
+STRONG_TYPEDEF(uint32_t, NodeID);   // NUMA node
 
 namespace opossum {
 
@@ -53,7 +55,17 @@ struct RowID {
 
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
-using PosList = std::vector<RowID>;
+// The column types a ValueColumn can be compressed into, see Table::compress_chunk
+// FrameOfReference only applies to integral columns, other columns are dictionary-encoded instead
+enum class EncodingType { Dictionary, RunLength, FrameOfReference };
+
+// How a table assigns its chunks to NUMA nodes, see Table::set_numa_placement
+// FirstTouch leaves the placement to the operating system, RoundRobin spreads the chunks over all nodes
+enum class NumaPlacement { FirstTouch, RoundRobin };
+
+// PosLists are polymorphic-allocator vectors, so that operators can place their results in a per-execution arena
+// (see AbstractOperator::_make_pos_list). A default-constructed PosList uses the global heap.
+using PosList = std::pmr::vector<RowID>;
 
 class Noncopyable {
  protected:
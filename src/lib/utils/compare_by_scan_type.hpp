@@ -0,0 +1,53 @@
+#pragma once
+
+#include <functional>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// returns whether `lhs <scan_type> rhs` holds, e.g., whether lhs < rhs for ScanType::OpLessThan
+// this branches on the scan type, so use it once per run, block, or chunk rather than once per row
+template <typename T>
+bool compare_by_scan_type(const ScanType scan_type, const T& lhs, const T& rhs) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return lhs == rhs;
+    case ScanType::OpNotEquals:
+      return lhs != rhs;
+    case ScanType::OpLessThan:
+      return lhs < rhs;
+    case ScanType::OpLessThanEquals:
+      return lhs <= rhs;
+    case ScanType::OpGreaterThan:
+      return lhs > rhs;
+    case ScanType::OpGreaterThanEquals:
+      return lhs >= rhs;
+  }
+  Fail("Unknown scan type.");
+  return false;
+}
+
+// calls the functor with the function object that implements the scan type, e.g., std::less<> for ScanType::OpLessThan
+// use this to instantiate loops over many values once per scan type instead of branching for every value
+template <typename Functor>
+void resolve_scan_type_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+  }
+  Fail("Unknown scan type.");
+}
+
+}  // namespace opossum
@@ -1,34 +1,25 @@
 #include "load_table.hpp"
 
-#include <fstream>
+#include <algorithm>
 #include <memory>
 #include <string>
-#include <vector>
+#include <utility>
 
 #include "storage/table.hpp"
+#include "utils/table_file_reader.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size) {
-  std::ifstream infile(file_name);
-  Assert(infile.is_open(), "load_table: Could not find file " + file_name);
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size, uint32_t num_threads) {
+  auto reader = TableFileReader{file_name};
+  auto table = reader.create_table(chunk_size);
 
-  std::string line;
-  std::getline(infile, line);
-  std::vector<std::string> col_names = _split<std::string>(line, '|');
-  std::getline(infile, line);
-  std::vector<std::string> col_types = _split<std::string>(line, '|');
-
-  std::shared_ptr<Table> test_table = std::make_shared<Table>(chunk_size);
-  for (size_t i = 0; i < col_names.size(); i++) {
-    test_table->add_column(col_names[i], col_types[i]);
-  }
-
-  while (std::getline(infile, line)) {
-    std::vector<AllTypeVariant> values = _split<AllTypeVariant>(line, '|');
-    test_table->append(values);
+  // a few chunks per thread balance chunks of different lengths, while only one batch is held besides the table
+  const auto chunks_per_batch = size_t{std::max(num_threads, uint32_t{1})} * 4;
+  while (reader.read_chunks(chunk_size, chunks_per_batch, num_threads,
+                            [&](Chunk&& chunk) { table->emplace_chunk(std::move(chunk)); })) {
   }
-  return test_table;
+  return table;
 }
 
 }  // namespace opossum
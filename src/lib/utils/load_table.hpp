@@ -1,28 +1,17 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
-#include <sstream>
 #include <string>
-#include <vector>
+#include <thread>
 
 namespace opossum {
 
 class Table;
 
-template <typename T>
-std::vector<T> _split(const std::string& str, char delimiter) {
-  std::vector<T> internal;
-  std::stringstream ss(str);
-  std::string tok;
-
-  while (std::getline(ss, tok, delimiter)) {
-    internal.push_back(tok);
-  }
-
-  return internal;
-}
-
 // This is a helper method which is heavily used in our test suite
-std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size);
+// It loads a .tbl file (see TableFileReader), parsing chunks in parallel using up to num_threads threads
+std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_size,
+                                  uint32_t num_threads = std::thread::hardware_concurrency());
 
 }  // namespace opossum
@@ -0,0 +1,57 @@
+#include "mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::string& file_name) {
+  const auto file_descriptor = ::open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "MappedFile: Could not open file " + file_name);
+
+  struct stat file_status;
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    Fail("MappedFile: Could not determine the size of " + file_name);
+  }
+
+  const auto size = static_cast<size_t>(file_status.st_size);
+  // mmap does not accept empty mappings, an empty file is represented by a nullptr
+  auto data = size == 0 ? nullptr : mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  // the mapping stays valid after the file is closed
+  close(file_descriptor);
+  Assert(data != MAP_FAILED, "MappedFile: Could not map file " + file_name);
+
+  return std::shared_ptr<const MappedFile>(new MappedFile(static_cast<const char*>(data), size));
+}
+
+MappedFile::MappedFile(const char* data, size_t size) : _data(data), _size(size) {}
+
+MappedFile::~MappedFile() {
+  if (_data) munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MappedFile::data() const { return _data; }
+
+size_t MappedFile::size() const { return _size; }
+
+void MappedFile::advise_sequential() const {
+  // the advice is only a hint, failing to give it is harmless
+  if (_data) madvise(const_cast<char*>(_data), _size, MADV_SEQUENTIAL);
+}
+
+void MappedFile::release_prefix(size_t size) const {
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto released_size = std::min(size, _size) / page_size * page_size;
+  if (released_size > 0) madvise(const_cast<char*>(_data), released_size, MADV_DONTNEED);
+}
+
+}  // namespace opossum
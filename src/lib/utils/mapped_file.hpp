@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// MappedFile maps a whole file read-only into memory. Data structures that refer to the mapping (e.g., ColumnBuffers
+// of a table loaded by map_binary_table) hold a shared_ptr to it, so that it is unmapped once the last of them is gone.
+class MappedFile : private Noncopyable {
+ public:
+  // maps the given file, throws if it cannot be opened or mapped
+  static std::shared_ptr<const MappedFile> open(const std::string& file_name);
+
+  ~MappedFile();
+
+  const char* data() const;
+  size_t size() const;
+
+  // tells the kernel that the file is read front to back, so that it reads ahead aggressively
+  void advise_sequential() const;
+
+  // Drops the pages of the first `size` bytes from the memory of the process, e.g., once they have been parsed. They
+  // are read from the file again if they are accessed later on. Pages that are only partially covered are kept.
+  void release_prefix(size_t size) const;
+
+ protected:
+  MappedFile(const char* data, size_t size);
+
+  const char* const _data;
+  const size_t _size;
+};
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// returns the number of bytes a string has allocated on the heap, which is 0 for strings short enough to be stored
+// inside the std::string object itself (small string optimization)
+inline size_t string_heap_memory_usage(const std::string& string) {
+  const auto object_begin = reinterpret_cast<const char*>(&string);
+  const auto is_inline = string.data() >= object_begin && string.data() < object_begin + sizeof(std::string);
+  return is_inline ? 0 : string.capacity() + 1;
+}
+
+// returns the number of bytes a vector has allocated on the heap, including the heap buffers of its strings
+template <typename T, typename Allocator>
+size_t vector_memory_usage(const std::vector<T, Allocator>& vector) {
+  auto bytes = vector.capacity() * sizeof(T);
+  if constexpr (std::is_same<T, std::string>::value) {
+    for (const auto& string : vector) bytes += string_heap_memory_usage(string);
+  }
+  return bytes;
+}
+
+}  // namespace opossum
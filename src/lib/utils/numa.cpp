@@ -0,0 +1,140 @@
+#include "numa.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "storage/column_memory_resource.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// from <numaif.h>, which is only available with libnuma
+constexpr int MPOL_PREFERRED_MODE = 1;
+
+std::string read_first_line(const std::string& path) {
+  std::ifstream file(path);
+  std::string line;
+  std::getline(file, line);
+  return line;
+}
+
+// Allocates whole pages with mmap and binds them to a NUMA node. It is only used as the upstream of a pool, which
+// requests large blocks and splits them up, so the page granularity does not matter.
+class NumaNodeMemoryResource : public std::pmr::memory_resource {
+ public:
+  explicit NumaNodeMemoryResource(const NodeID node) : _node(node) {}
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    const auto length = _round_to_pages(bytes);
+    Assert(alignment <= _page_size(), "NumaNodeMemoryResource does not support alignments larger than a page.");
+
+    auto memory = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) throw std::bad_alloc();
+
+    // the memory is bound before it is touched, so that the pages are allocated on the node in the first place
+    std::vector<unsigned long> node_mask(_node / (8 * sizeof(unsigned long)) + 1);  // NOLINT(runtime/int)
+    node_mask[_node / (8 * sizeof(unsigned long))] |= 1ul << (_node % (8 * sizeof(unsigned long)));
+    const auto max_node = node_mask.size() * 8 * sizeof(unsigned long) + 1;
+    // if mbind fails (e.g., inside a container that forbids it), the kernel's default policy places the memory
+    syscall(SYS_mbind, memory, length, MPOL_PREFERRED_MODE, node_mask.data(), max_node, 0);
+    return memory;
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t) override { munmap(pointer, _round_to_pages(bytes)); }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+  static size_t _page_size() {
+    static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return page_size;
+  }
+
+  static size_t _round_to_pages(const size_t bytes) { return (bytes + _page_size() - 1) / _page_size() * _page_size(); }
+
+  const NodeID _node;
+};
+
+}  // namespace
+
+std::vector<uint32_t> parse_cpu_list(const std::string& list) {
+  std::vector<uint32_t> values;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+    const auto dash = range.find('-');
+    const auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+    const auto last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+    for (auto value = first; value <= last; ++value) values.push_back(value);
+  }
+  return values;
+}
+
+uint32_t numa_node_count() {
+  static const auto node_count = []() {
+    try {
+      const auto nodes = parse_cpu_list(read_first_line("/sys/devices/system/node/online"));
+      return nodes.empty() ? uint32_t{1} : *std::max_element(nodes.begin(), nodes.end()) + 1;
+    } catch (const std::exception&) {
+      return uint32_t{1};
+    }
+  }();
+  return node_count;
+}
+
+std::vector<uint32_t> numa_node_cpus(const NodeID node) {
+  try {
+    return parse_cpu_list(read_first_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+  } catch (const std::exception&) {
+    return {};
+  }
+}
+
+std::pmr::memory_resource* numa_memory_resource(const NodeID node) {
+  // one pool per node, intentionally leaked like the default column memory resource
+  static const auto node_resources = []() {
+    std::vector<std::pmr::memory_resource*> resources;
+    if (numa_node_count() == 1) return resources;
+    for (NodeID::base_type node_index = 0; node_index < numa_node_count(); ++node_index) {
+      const auto upstream = new NumaNodeMemoryResource(NodeID{node_index});
+      resources.push_back(new std::pmr::synchronized_pool_resource(upstream));
+    }
+    return resources;
+  }();
+
+  return node < node_resources.size() ? node_resources[node] : column_memory_resource();
+}
+
+ScopedNumaAffinity::ScopedNumaAffinity(const NodeID node) {
+  if (node == UNDEFINED_NODE_ID || numa_node_count() == 1) return;
+
+  const auto cpus = numa_node_cpus(node);
+  if (cpus.empty() || sched_getaffinity(0, sizeof(_previous_cpus), &_previous_cpus) != 0) return;
+
+  cpu_set_t node_cpus;
+  CPU_ZERO(&node_cpus);
+  for (const auto cpu : cpus) {
+    if (cpu < CPU_SETSIZE) CPU_SET(cpu, &node_cpus);
+  }
+  _is_pinned = sched_setaffinity(0, sizeof(node_cpus), &node_cpus) == 0;
+}
+
+ScopedNumaAffinity::~ScopedNumaAffinity() {
+  if (_is_pinned) sched_setaffinity(0, sizeof(_previous_cpus), &_previous_cpus);
+}
+
+bool ScopedNumaAffinity::is_pinned() const { return _is_pinned; }
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <sched.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// the NUMA node of a chunk that has not been placed on a specific node
+constexpr NodeID UNDEFINED_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
+
+// Returns the number of NUMA nodes of the machine, as listed in /sys/devices/system/node/online.
+// Returns 1 if the topology cannot be read, e.g., on systems without NUMA support.
+uint32_t numa_node_count();
+
+// Returns the CPUs of a NUMA node, as listed in /sys/devices/system/node/node<N>/cpulist, or an empty list if they
+// cannot be read.
+std::vector<uint32_t> numa_node_cpus(NodeID node);
+
+// parses a list in the format used by sysfs, e.g., "0-3,8,10-11"
+std::vector<uint32_t> parse_cpu_list(const std::string& list);
+
+// Returns a pooled memory resource whose memory is bound to the given NUMA node (using mbind with MPOL_PREFERRED, so
+// allocations still succeed if the node runs out of memory). On single-node hosts and for nodes that do not exist,
+// this is column_memory_resource(). If mbind fails, the memory is placed by the kernel's default policy instead.
+std::pmr::memory_resource* numa_memory_resource(NodeID node);
+
+// Pins the calling thread to the CPUs of a NUMA node for its lifetime and restores the previous affinity afterwards.
+// Does nothing on single-node hosts, for UNDEFINED_NODE_ID, or if the affinity cannot be changed.
+class ScopedNumaAffinity : private Noncopyable {
+ public:
+  explicit ScopedNumaAffinity(NodeID node);
+  ~ScopedNumaAffinity();
+
+  // returns whether the thread is currently pinned to the node
+  bool is_pinned() const;
+
+ protected:
+  bool _is_pinned = false;
+  cpu_set_t _previous_cpus;
+};
+
+}  // namespace opossum
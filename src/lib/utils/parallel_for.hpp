@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Calls func(index) for every index in [0, count) using up to num_threads threads, including the calling thread.
+ * Indices are handed out one at a time, so tasks of different lengths are balanced across the threads.
+ * Returns once all calls have finished. If a call throws, no further indices are handed out and the first exception
+ * is rethrown on the calling thread.
+ *
+ * Example:
+ *
+ *   parallel_for(chunk_count, std::thread::hardware_concurrency(), [&](size_t chunk_index) {
+ *     process(chunks[chunk_index]);
+ *   });
+ */
+template <typename Functor>
+void parallel_for(const size_t count, const uint32_t num_threads, const Functor& func) {
+  std::atomic<size_t> next_index{0};
+  std::atomic<bool> failed{false};
+  std::exception_ptr exception;
+  std::mutex exception_mutex;
+
+  const auto work = [&]() {
+    while (!failed) {
+      const auto index = next_index++;
+      if (index >= count) return;
+
+      try {
+        func(index);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (!exception) exception = std::current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  const auto thread_count = std::min(static_cast<size_t>(std::max(num_threads, uint32_t{1})), count);
+  std::vector<std::thread> threads;
+  for (size_t thread_index = 1; thread_index < thread_count; ++thread_index) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) thread.join();
+
+  if (exception) std::rethrow_exception(exception);
+}
+
+}  // namespace opossum
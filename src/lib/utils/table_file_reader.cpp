@@ -0,0 +1,272 @@
+#include "table_file_reader.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/validity_bitmap.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+#include "utils/mapped_file.hpp"
+#include "utils/parallel_for.hpp"
+
+namespace opossum {
+
+namespace {
+
+// slices of a single chunk (chunk size 0) are at least this large, smaller files are parsed by one thread
+constexpr size_t MIN_SLICE_SIZE = 1u << 20;
+
+// a range of complete lines of the file
+struct Slice {
+  const char* begin;
+  const char* end;
+};
+
+// collects the parsed values of one column of a slice
+class BaseFieldParser {
+ public:
+  virtual ~BaseFieldParser() = default;
+
+  virtual void reserve(size_t row_count) = 0;
+
+  // parses the field [begin, end) and appends its value
+  virtual void parse(const char* begin, const char* end) = 0;
+
+  // moves the values of another parser of the same type to the end
+  virtual void append(BaseFieldParser& other) = 0;
+
+  // moves the values into a ValueColumn
+  virtual std::shared_ptr<BaseColumn> finish() = 0;
+};
+
+template <typename T>
+class FieldParser : public BaseFieldParser {
+ public:
+  FieldParser(const std::string& column_name, const bool nullable) : _column_name(column_name) {
+    if (nullable) _validity.emplace();
+  }
+
+  void reserve(size_t row_count) override { _values.reserve(row_count); }
+
+  void parse(const char* begin, const char* end) override {
+    if (_validity) {
+      const auto is_null = std::string_view(begin, end - begin) == TBL_NULL_FIELD;
+      _validity->push_back(!is_null);
+      if (is_null) {
+        _values.emplace_back();
+        return;
+      }
+    }
+
+    if constexpr (std::is_same<T, std::string>::value) {
+      _values.emplace_back(begin, end);
+    } else {
+      T value;
+      const auto result = std::from_chars(begin, end, value);
+      if (result.ec != std::errc() || result.ptr != end) {
+        Fail("TableFileReader: Could not parse '" + std::string(begin, end) + "' in column " + _column_name);
+      }
+      _values.push_back(value);
+    }
+  }
+
+  void append(BaseFieldParser& other) override {
+    auto& other_values = static_cast<FieldParser<T>&>(other)._values;
+    _values.insert(_values.end(), std::make_move_iterator(other_values.begin()),
+                   std::make_move_iterator(other_values.end()));
+    other_values = {};
+
+    if (_validity) {
+      const auto& other_validity = *static_cast<FieldParser<T>&>(other)._validity;
+      for (size_t row = 0; row < other_validity.size(); ++row) _validity->push_back(other_validity.is_valid(row));
+    }
+  }
+
+  std::shared_ptr<BaseColumn> finish() override {
+    return std::make_shared<ValueColumn<T>>(std::move(_values), std::move(_validity));
+  }
+
+ protected:
+  const std::string& _column_name;
+  std::vector<T> _values;
+  std::optional<ValidityBitmap> _validity;
+};
+
+using FieldParsers = std::vector<std::unique_ptr<BaseFieldParser>>;
+
+}  // namespace
+
+TableFileReader::TableFileReader(const std::string& file_name, const char delimiter)
+    : _file(MappedFile::open(file_name)), _file_name(file_name), _delimiter(delimiter) {
+  _file->advise_sequential();
+  _position = _file->data();
+  _end = _file->data() + _file->size();
+
+  _column_names = _read_header_line();
+  _column_types = _read_header_line();
+  Assert(_column_names.size() == _column_types.size(),
+         "TableFileReader: Number of column names and types differs in " + file_name);
+
+  for (auto& column_type : _column_types) {
+    const auto suffix_length = std::strlen(TBL_NULLABLE_TYPE_SUFFIX);
+    const auto is_nullable = column_type.size() > suffix_length &&
+                             column_type.compare(column_type.size() - suffix_length, suffix_length,
+                                                 TBL_NULLABLE_TYPE_SUFFIX) == 0;
+    if (is_nullable) column_type.resize(column_type.size() - suffix_length);
+    _column_nullables.push_back(is_nullable);
+
+    auto is_known_type = false;
+    resolve_data_type(column_type, [&](auto) { is_known_type = true; });
+    Assert(is_known_type, "TableFileReader: Unknown column type " + column_type + " in " + file_name);
+  }
+}
+
+const std::vector<std::string>& TableFileReader::column_names() const { return _column_names; }
+
+const std::vector<std::string>& TableFileReader::column_types() const { return _column_types; }
+
+bool TableFileReader::column_is_nullable(const size_t column_index) const { return _column_nullables[column_index]; }
+
+std::shared_ptr<Table> TableFileReader::create_table(const uint32_t chunk_size) const {
+  auto table = std::make_shared<Table>(chunk_size);
+  for (size_t column_index = 0; column_index < _column_names.size(); ++column_index) {
+    table->add_column(_column_names[column_index], _column_types[column_index], _column_nullables[column_index]);
+  }
+  return table;
+}
+
+size_t TableFileReader::read_chunks(const uint32_t chunk_size, const size_t max_chunk_count,
+                                    const uint32_t num_threads, const std::function<void(Chunk&&)>& consumer) {
+  if (at_end() || max_chunk_count == 0) return 0;
+
+  // find the rows of each slice, which is a whole chunk or, for a chunk size of 0, a part of the only chunk
+  std::vector<Slice> slices;
+  if (chunk_size != 0) {
+    while (slices.size() < max_chunk_count && _position < _end) {
+      const auto slice_end = _skip_rows(_position, chunk_size);
+      slices.push_back({_position, slice_end});
+      _position = slice_end;
+    }
+  } else {
+    // split the remaining bytes evenly and move each boundary to the beginning of the next line
+    const auto begin = _position;
+    const auto byte_count = static_cast<size_t>(_end - begin);
+    const auto slice_count = std::clamp(byte_count / MIN_SLICE_SIZE, size_t{1}, size_t{num_threads} * 4);
+    for (size_t slice_index = 1; slice_index <= slice_count; ++slice_index) {
+      const auto slice_end = _next_line(begin + byte_count * slice_index / slice_count - 1);
+      if (slice_end <= _position) continue;
+      slices.push_back({_position, slice_end});
+      _position = slice_end;
+    }
+  }
+
+  std::vector<FieldParsers> parsed_slices(slices.size());
+  parallel_for(slices.size(), num_threads, [&](size_t slice_index) {
+    auto& parsers = parsed_slices[slice_index];
+    for (size_t column_index = 0; column_index < _column_types.size(); ++column_index) {
+      parsers.emplace_back(make_unique_by_column_type<BaseFieldParser, FieldParser>(
+          _column_types[column_index], _column_names[column_index], _column_nullables[column_index]));
+      if (chunk_size != 0) parsers.back()->reserve(chunk_size);
+    }
+
+    const auto& slice = slices[slice_index];
+    const auto column_count = parsers.size();
+    for (auto line_begin = slice.begin; line_begin < slice.end;) {
+      const auto line_end = static_cast<const char*>(std::memchr(line_begin, '\n', slice.end - line_begin));
+      const auto next_line_begin = line_end ? line_end + 1 : slice.end;
+      auto fields_end = line_end ? line_end : slice.end;
+      if (fields_end > line_begin && fields_end[-1] == '\r') --fields_end;
+
+      auto field_begin = line_begin;
+      for (size_t column_index = 0; column_index < column_count; ++column_index) {
+        auto field_end = static_cast<const char*>(std::memchr(field_begin, _delimiter, fields_end - field_begin));
+        if (!field_end) {
+          if (column_index + 1 < column_count) {
+            Fail("TableFileReader: Too few fields in line '" + std::string(line_begin, fields_end) + "'");
+          }
+          field_end = fields_end;
+        }
+        parsers[column_index]->parse(field_begin, field_end);
+        field_begin = field_end == fields_end ? fields_end : field_end + 1;
+      }
+      if (field_begin != fields_end) {
+        Fail("TableFileReader: Too many fields in line '" + std::string(line_begin, fields_end) + "'");
+      }
+
+      line_begin = next_line_begin;
+    }
+  });
+
+  if (chunk_size == 0) {
+    // concatenate the slices of the only chunk
+    for (size_t slice_index = 1; slice_index < parsed_slices.size(); ++slice_index) {
+      for (size_t column_index = 0; column_index < _column_types.size(); ++column_index) {
+        parsed_slices.front()[column_index]->append(*parsed_slices[slice_index][column_index]);
+      }
+    }
+    parsed_slices.resize(1);
+  }
+
+  for (auto& parsers : parsed_slices) {
+    Chunk chunk;
+    for (auto& parser : parsers) {
+      chunk.add_column(parser->finish());
+    }
+    consumer(std::move(chunk));
+  }
+
+  // the parsed part of the file is not needed anymore, which keeps the memory of the process bounded for large files
+  _file->release_prefix(static_cast<size_t>(_position - _file->data()));
+  return parsed_slices.size();
+}
+
+bool TableFileReader::at_end() const { return _position >= _end; }
+
+std::vector<std::string> TableFileReader::_read_header_line() {
+  Assert(_position < _end, "TableFileReader: Missing header in " + _file_name);
+
+  const auto line_begin = _position;
+  _position = _next_line(_position);
+  auto line_end = _position;
+  if (line_end > line_begin && line_end[-1] == '\n') --line_end;
+  if (line_end > line_begin && line_end[-1] == '\r') --line_end;
+  if (line_end > line_begin && line_end[-1] == _delimiter) --line_end;
+
+  std::vector<std::string> fields;
+  auto field_begin = line_begin;
+  while (true) {
+    const auto field_end = std::find(field_begin, line_end, _delimiter);
+    fields.emplace_back(field_begin, field_end);
+    if (field_end == line_end) break;
+    field_begin = field_end + 1;
+  }
+  return fields;
+}
+
+const char* TableFileReader::_skip_rows(const char* position, const size_t count) const {
+  for (size_t row = 0; row < count && position < _end; ++row) {
+    position = _next_line(position);
+  }
+  return position;
+}
+
+const char* TableFileReader::_next_line(const char* position) const {
+  const auto line_end = static_cast<const char*>(std::memchr(position, '\n', _end - position));
+  return line_end ? line_end + 1 : _end;
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class MappedFile;
+class Table;
+
+// the type of a nullable column carries this suffix in the header of a .tbl file, e.g., "int_null"
+constexpr auto TBL_NULLABLE_TYPE_SUFFIX = "_null";
+// the field of a NULL value in a nullable column
+constexpr auto TBL_NULL_FIELD = "null";
+
+/**
+ * TableFileReader parses text files in the .tbl format: a line of column names, a line of column types, and one line
+ * per row, with fields separated by a delimiter ('|' for .tbl files, ',' for simple CSV files). A single delimiter at
+ * the end of a line is ignored. Quoted fields are not supported. Columns whose type ends with TBL_NULLABLE_TYPE_SUFFIX
+ * are nullable, and their TBL_NULL_FIELD fields are NULL.
+ *
+ * The file is memory-mapped and handed out chunk by chunk: the reader finds the row boundaries of the next chunks and
+ * then parses them in parallel, converting each field with std::from_chars directly into the typed vector of its
+ * ValueColumn. Finished chunks are passed on in the order of the file. Only the chunks of one call of read_chunks()
+ * are held in memory by the reader, and the pages of the file that have been parsed are released after each call, so
+ * a consumer that compresses chunks or writes them elsewhere can process files larger than memory (see ImportCsv).
+ *
+ * Example:
+ *
+ *   auto reader = TableFileReader{"lineitem.tbl"};
+ *   auto table = reader.create_table(100'000);
+ *   while (reader.read_chunks(100'000, 32, 8, [&](Chunk&& chunk) { table->emplace_chunk(std::move(chunk)); })) {}
+ */
+class TableFileReader : private Noncopyable {
+ public:
+  // maps the file and parses its header, throws if the file cannot be read or the header is invalid
+  explicit TableFileReader(const std::string& file_name, char delimiter = '|');
+
+  const std::vector<std::string>& column_names() const;
+  // the types without TBL_NULLABLE_TYPE_SUFFIX
+  const std::vector<std::string>& column_types() const;
+  bool column_is_nullable(size_t column_index) const;
+
+  // creates an empty table with the columns of the file
+  std::shared_ptr<Table> create_table(uint32_t chunk_size) const;
+
+  // Parses up to max_chunk_count chunks of chunk_size rows using up to num_threads threads and calls consumer for each
+  // of them in order. A chunk size of 0 reads all remaining rows into a single chunk. Returns the number of chunks that
+  // were read, which is 0 once the end of the file has been reached. Throws if a row cannot be parsed, in which case
+  // no chunk of this call is passed on.
+  size_t read_chunks(uint32_t chunk_size, size_t max_chunk_count, uint32_t num_threads,
+                     const std::function<void(Chunk&&)>& consumer);
+
+  // returns whether all rows have been read
+  bool at_end() const;
+
+ protected:
+  // reads the next line of the header and splits it into its fields
+  std::vector<std::string> _read_header_line();
+
+  // returns the position after the next count rows, or the end of the file if there are fewer rows
+  const char* _skip_rows(const char* position, size_t count) const;
+
+  // returns the beginning of the line after position, or the end of the file
+  const char* _next_line(const char* position) const;
+
+  std::shared_ptr<const MappedFile> _file;
+  const std::string _file_name;
+  const char _delimiter;
+
+  const char* _position;
+  const char* _end;
+
+  std::vector<std::string> _column_names;
+  std::vector<std::string> _column_types;
+  std::vector<bool> _column_nullables;
+};
+
+}  // namespace opossum
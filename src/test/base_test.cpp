@@ -123,6 +123,13 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& m) {
 
   for (unsigned row = 0; row < left.size(); row++)
     for (ColumnID col{0}; col < left[row].size(); col++) {
+      // NULLs cannot be cast to the type of their column
+      if (variant_is_null(left[row][col]) || variant_is_null(right[row][col])) {
+        EXPECT_EQ(variant_is_null(left[row][col]), variant_is_null(right[row][col]))
+            << "Row:" << row + 1 << " Col:" << col + 1;
+        continue;
+      }
+
       if (tleft.column_type(col) == "float") {
         auto left_val = type_cast<float>(left[row][col]);
         auto right_val = type_cast<float>(right[row][col]);
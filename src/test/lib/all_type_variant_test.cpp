@@ -73,4 +73,12 @@ TEST_F(AllTypeVariantTest, GetExtractsExactNumericalValue) {
   }
 }
 
+TEST_F(AllTypeVariantTest, NullValue) {
+  EXPECT_TRUE(variant_is_null(NULL_VALUE));
+  EXPECT_TRUE(variant_is_null(AllTypeVariant{}));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{0}));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{std::string{}}));
+  EXPECT_THROW(type_cast<int32_t>(NULL_VALUE), std::exception);
+}
+
 }  // namespace opossum
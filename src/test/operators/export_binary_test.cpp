@@ -0,0 +1,64 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_binary.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/binary_table.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsExportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(10);
+    table->add_column("a", "int");
+    table->add_column("b", "string", true);
+    for (int i = 0; i < 35; ++i) table->append({i, i % 4 == 0 ? NULL_VALUE : AllTypeVariant{std::to_string(i % 5)}});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{2});
+
+    _table = table;
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::shared_ptr<const Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  const std::string _file_name = testing::TempDir() + "operators_export_binary_test.bin";
+};
+
+TEST_F(OperatorsExportBinaryTest, KeepsEncoding) {
+  auto export_binary = std::make_shared<ExportBinary>(_table_wrapper, _file_name);
+  export_binary->execute();
+  EXPECT_EQ(export_binary->get_output(), _table);
+
+  const auto loaded_table = map_binary_table(_file_name);
+  EXPECT_TABLE_EQ(loaded_table, _table, true);
+  EXPECT_EQ(loaded_table->chunk_count(), 4u);
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{0}).get_column(ColumnID{1})->encoding_name(), "Dictionary");
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{1}).get_column(ColumnID{1})->encoding_name(), "Unencoded");
+}
+
+TEST_F(OperatorsExportBinaryTest, MaterializesReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 8);
+  scan->execute();
+  auto export_binary = std::make_shared<ExportBinary>(scan, _file_name);
+  export_binary->execute();
+
+  const auto loaded_table = map_binary_table(_file_name);
+  EXPECT_TABLE_EQ(loaded_table, scan->get_output(), true);
+  EXPECT_EQ(loaded_table->row_count(), 27u);
+  EXPECT_TRUE(loaded_table->column_is_nullable(ColumnID{1}));
+  EXPECT_EQ(loaded_table->get_chunk(ChunkID{0}).get_column(ColumnID{0})->encoding_name(), "Unencoded");
+}
+
+}  // namespace opossum
@@ -0,0 +1,130 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_csv.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsExportCsvTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(4);
+    table->add_column("a", "int");
+    table->add_column("b", "long");
+    table->add_column("c", "float");
+    table->add_column("d", "double");
+    table->add_column("e", "string");
+    for (int i = 0; i < 10; ++i) {
+      table->append({i, int64_t{i} * 1'000'000'000, i + 0.1f, i / 3.0, "s" + std::to_string(i % 3)});
+    }
+    _table = table;
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::string _read_file() const {
+    std::ifstream file(_file_name);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  std::shared_ptr<const AbstractOperator> _wrap(const std::shared_ptr<const Table>& table) const {
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = testing::TempDir() + "operators_export_csv_test.tbl";
+};
+
+TEST_F(OperatorsExportCsvTest, RoundTripsThroughLoadTable) {
+  _table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  _table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  auto export_csv = std::make_shared<ExportCsv>(_wrap(_table), _file_name, '|', 2);
+  export_csv->execute();
+  EXPECT_EQ(export_csv->get_output(), _table);
+
+  EXPECT_TABLE_EQ(load_table(_file_name, 4), _table, true);
+}
+
+TEST_F(OperatorsExportCsvTest, WritesTblFormat) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "int");
+  table->add_column("b", "string", true);
+  table->append({1, "x"});
+  table->append({-2, NULL_VALUE});
+  table->append({3, "yz"});
+  table->compress_chunk(ChunkID{0});
+
+  std::make_shared<ExportCsv>(_wrap(table), _file_name, ',')->execute();
+  EXPECT_EQ(_read_file(), "a,b\nint,string_null\n1,x\n-2,null\n3,yz\n");
+}
+
+TEST_F(OperatorsExportCsvTest, RoundTripsNulls) {
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", true);
+  table->add_column("b", "double", true);
+  table->add_column("c", "string", true);
+  for (int i = 0; i < 10; ++i) {
+    table->append({i % 3 == 0 ? NULL_VALUE : AllTypeVariant{i}, i % 4 == 0 ? NULL_VALUE : AllTypeVariant{i / 2.0},
+                   i % 5 == 0 ? NULL_VALUE : AllTypeVariant{"s" + std::to_string(i)}});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  table->compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+
+  std::make_shared<ExportCsv>(_wrap(table), _file_name)->execute();
+  const auto loaded_table = load_table(_file_name, 3);
+  EXPECT_TABLE_EQ(loaded_table, table, true);
+  for (auto column_id = ColumnID{0}; column_id < loaded_table->col_count(); ++column_id) {
+    EXPECT_TRUE(loaded_table->column_is_nullable(column_id));
+  }
+}
+
+TEST_F(OperatorsExportCsvTest, MaterializesReferenceColumns) {
+  auto scan = std::make_shared<TableScan>(_wrap(_table), ColumnID{0}, ScanType::OpGreaterThanEquals, 3);
+  scan->execute();
+
+  std::make_shared<ExportCsv>(scan, _file_name)->execute();
+  const auto loaded_table = load_table(_file_name, 4);
+  EXPECT_TABLE_EQ(loaded_table, scan->get_output(), true);
+  EXPECT_EQ(loaded_table->row_count(), 7u);
+}
+
+TEST_F(OperatorsExportCsvTest, RejectsStringsWithDelimiter) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "string");
+  table->append({"x|y"});
+
+  EXPECT_THROW(std::make_shared<ExportCsv>(_wrap(table), _file_name)->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsExportCsvTest, RejectsAmbiguousFields) {
+  for (const auto& column_name : {"a|b", "a\nb", "a\r"}) {
+    auto table = std::make_shared<Table>();
+    table->add_column(column_name, "int");
+    table->append({1});
+    EXPECT_THROW(std::make_shared<ExportCsv>(_wrap(table), _file_name)->execute(), std::logic_error);
+  }
+
+  // the string "null" would be read back as NULL
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "string", true);
+  table->append({"null"});
+  EXPECT_THROW(std::make_shared<ExportCsv>(_wrap(table), _file_name)->execute(), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/import_binary.hpp"
+#include "storage/binary_table.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportBinaryTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    _table->compress_chunk(ChunkID{0});
+    write_binary_table(*_table, _file_name);
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  std::shared_ptr<Table> _table;
+  const std::string _file_name = testing::TempDir() + "operators_import_binary_test.bin";
+};
+
+TEST_F(OperatorsImportBinaryTest, Import) {
+  auto import_binary = std::make_shared<ImportBinary>(_file_name);
+  import_binary->execute();
+
+  EXPECT_TABLE_EQ(import_binary->get_output(), _table, true);
+  EXPECT_EQ(import_binary->get_output()->chunk_size(), 2u);
+  EXPECT_FALSE(StorageManager::get().has_table("int_float"));
+}
+
+TEST_F(OperatorsImportBinaryTest, AddsTableToStorageManager) {
+  auto import_binary = std::make_shared<ImportBinary>(_file_name, "int_float");
+  import_binary->execute();
+
+  ASSERT_TRUE(StorageManager::get().has_table("int_float"));
+  EXPECT_EQ(StorageManager::get().get_table("int_float"), import_binary->get_output());
+}
+
+TEST_F(OperatorsImportBinaryTest, ThrowsForMissingFile) {
+  auto import_binary = std::make_shared<ImportBinary>(_file_name + ".missing");
+  EXPECT_THROW(import_binary->execute(), std::logic_error);
+}
+
+}  // namespace opossum
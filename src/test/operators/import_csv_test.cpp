@@ -0,0 +1,97 @@
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/import_csv.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class OperatorsImportCsvTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::ofstream file(_file_name);
+    file << "a|b\nint|string\n";
+    for (int i = 0; i < 100; ++i) file << i << "|" << (i % 3 == 0 ? "x" : "y") << "\n";
+  }
+
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  const std::string _file_name = testing::TempDir() + "operators_import_csv_test.tbl";
+};
+
+TEST_F(OperatorsImportCsvTest, Import) {
+  auto import_csv = std::make_shared<ImportCsv>(_file_name, 10);
+  import_csv->execute();
+
+  EXPECT_TABLE_EQ(import_csv->get_output(), load_table(_file_name, 10), true);
+  EXPECT_EQ(import_csv->get_output()->chunk_count(), 10u);
+  EXPECT_FALSE(StorageManager::get().has_table("t"));
+}
+
+TEST_F(OperatorsImportCsvTest, PublishesAndCompressesChunks) {
+  auto import_csv = std::make_shared<ImportCsv>(_file_name, 15, "t", EncodingType::Dictionary, '|', 2);
+  import_csv->execute();
+
+  ASSERT_TRUE(StorageManager::get().has_table("t"));
+  const auto table = StorageManager::get().get_table("t");
+  EXPECT_EQ(table, import_csv->get_output());
+  EXPECT_EQ(table->row_count(), 100u);
+  EXPECT_EQ(table->chunk_count(), 7u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id).get_column(ColumnID{1})->encoding_name(), "Dictionary");
+  }
+}
+
+TEST_F(OperatorsImportCsvTest, KeepsChunksLoadedBeforeAnError) {
+  std::ofstream(_file_name, std::ios::app) << "oops|x\n";
+
+  // two threads parse batches of two chunks, so the first 100 rows are published before the invalid row is parsed
+  auto import_csv = std::make_shared<ImportCsv>(_file_name, 25, "t", std::nullopt, '|', 2);
+  EXPECT_THROW(import_csv->execute(), std::logic_error);
+
+  ASSERT_TRUE(StorageManager::get().has_table("t"));
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 100u);
+}
+
+TEST_F(OperatorsImportCsvTest, ConcurrentScansDuringImport) {
+  std::atomic_bool is_done{false};
+  std::thread scanner([&]() {
+    while (!is_done) {
+      if (!StorageManager::get().has_table("t")) continue;
+
+      // the table is only published with its first chunk, which is never replaced while a scan refers to it
+      EXPECT_GT(StorageManager::get().get_table("t")->get_chunk(ChunkID{0}).size(), 0u);
+      auto table_wrapper = std::make_shared<TableWrapper>(StorageManager::get().get_table("t"));
+      table_wrapper->execute();
+      auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+      table_scan->execute();
+      EXPECT_GT(table_scan->get_output()->row_count(), 0u);
+    }
+  });
+
+  // one chunk per row and batch publishes the table long before the import is done
+  auto import_csv = std::make_shared<ImportCsv>(_file_name, 1, "t", EncodingType::Dictionary, '|', 1);
+  import_csv->execute();
+  is_done = true;
+  scanner.join();
+
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 100u);
+  auto table_wrapper = std::make_shared<TableWrapper>(StorageManager::get().get_table("t"));
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 100u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,190 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "../lib/storage/index/binary_comparable_key.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  template <typename T>
+  static BinaryComparableKey key(const T& value) {
+    BinaryComparableKey key;
+    append_binary_comparable(key, value);
+    return key;
+  }
+
+  template <typename T>
+  static void expect_ordered(const std::vector<T>& sorted_values) {
+    for (size_t index = 1; index < sorted_values.size(); ++index) {
+      EXPECT_LT(key(sorted_values[index - 1]), key(sorted_values[index])) << "at index " << index;
+    }
+  }
+
+  static std::vector<ChunkOffset> offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+};
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, BinaryComparableKeys) {
+  expect_ordered<int32_t>({std::numeric_limits<int32_t>::min(), -256, -1, 0, 1, 255, 256,
+                           std::numeric_limits<int32_t>::max()});
+  expect_ordered<int64_t>({std::numeric_limits<int64_t>::min(), -1, 0, int64_t{1} << 40,
+                           std::numeric_limits<int64_t>::max()});
+  expect_ordered<float>({-std::numeric_limits<float>::infinity(), -2.5f, -1.0f, 0.0f, 1e-20f, 1.0f, 2.5f,
+                         std::numeric_limits<float>::infinity()});
+  expect_ordered<double>({std::numeric_limits<double>::lowest(), -1e100, -0.5, 0.0, 0.5, 1e100});
+  expect_ordered<std::string>({"", std::string("\0", 1), std::string("\0\0", 2), "a", std::string("a\0", 2), "a\x01",
+                               "ab", "b", "\xff"});
+  EXPECT_EQ(key(-0.0f), key(0.0f));
+  EXPECT_EQ(key(-0.0), key(0.0));
+  EXPECT_EQ(key(int32_t{-1}).size(), 4u);
+  EXPECT_EQ(key(std::string("ab")).size(), 4u);
+
+  EXPECT_EQ(prefix_successor({0x01, 0xFF, 0xFF}), (BinaryComparableKey{0x02}));
+  EXPECT_EQ(prefix_successor({0xFF}), BinaryComparableKey{});
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, SingleColumn) {
+  auto value_column = std::make_shared<ValueColumn<std::string>>();
+  for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+    value_column->append(value);
+  }
+  const auto index = AdaptiveRadixTreeIndex({value_column});
+
+  EXPECT_EQ(offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(offsets(index.lower_bound({"delta"}), index.upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index.lower_bound({"bravo"}), index.upper_bound({"bravo"})), std::vector<ChunkOffset>{});
+  EXPECT_EQ(offsets(index.lower_bound({"charlie"}), index.upper_bound({"frank"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+  EXPECT_EQ(offsets(index.lower_bound({"d"}), index.upper_bound({"g"})), (std::vector<ChunkOffset>{1, 3, 2}));
+
+  EXPECT_EQ(index.lower_bound({"apple"}), index.cbegin());
+  EXPECT_EQ(index.lower_bound({""}), index.cbegin());
+  EXPECT_EQ(index.upper_bound({"inbox"}), index.cend());
+  EXPECT_EQ(index.lower_bound({"zulu"}), index.cend());
+  EXPECT_EQ(index.indexed_columns(), (std::vector<std::shared_ptr<const BaseColumn>>{value_column}));
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, MultipleColumns) {
+  auto first_column = std::make_shared<ValueColumn<int32_t>>();
+  first_column->append_batch({3, -1, 3, 7, -1, 3});
+  auto second_value_column = std::make_shared<ValueColumn<std::string>>();
+  second_value_column->append_batch({"b", "z", "a", "a", "z", "b"});
+  const auto second_column = std::make_shared<DictionaryColumn<std::string>>(second_value_column);
+
+  const auto index = AdaptiveRadixTreeIndex({first_column, second_column});
+  EXPECT_EQ(offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{1, 4, 2, 0, 5, 3}));
+
+  // lookups on all columns
+  EXPECT_EQ(offsets(index.lower_bound({3, "b"}), index.upper_bound({3, "b"})), (std::vector<ChunkOffset>{0, 5}));
+  EXPECT_EQ(offsets(index.lower_bound({3, "c"}), index.upper_bound({3, "c"})), std::vector<ChunkOffset>{});
+  EXPECT_EQ(offsets(index.lower_bound({3, "b"}), index.cend()), (std::vector<ChunkOffset>{0, 5, 3}));
+
+  // prefix lookups on the first column
+  EXPECT_EQ(offsets(index.lower_bound({3}), index.upper_bound({3})), (std::vector<ChunkOffset>{2, 0, 5}));
+  EXPECT_EQ(offsets(index.lower_bound({0}), index.upper_bound({5})), (std::vector<ChunkOffset>{2, 0, 5}));
+  EXPECT_EQ(index.upper_bound({7}), index.cend());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, ManyDistinctBytes) {
+  // 1000 distinct values make the tree use all node types, including nodes with more than 48 children
+  auto value_column = std::make_shared<ValueColumn<int64_t>>();
+  for (int64_t value = 0; value < 1000; ++value) value_column->append((value * 7919) % 1000 - 500);
+  const auto run_length_column = std::make_shared<RunLengthColumn<int64_t>>(value_column);
+  const auto index = AdaptiveRadixTreeIndex({run_length_column});
+
+  for (int64_t value = -502; value < 502; ++value) {
+    const auto lower = index.lower_bound({value});
+    const auto upper = index.upper_bound({value});
+    if (value < -500 || value >= 500) {
+      EXPECT_EQ(lower, upper);
+    } else {
+      ASSERT_EQ(std::distance(lower, upper), 1);
+      EXPECT_EQ(run_length_column->get(*lower), value);
+    }
+    EXPECT_EQ(std::distance(index.cbegin(), lower), std::clamp<int64_t>(value + 500, 0, 1000));
+  }
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, InvalidColumns) {
+  auto int_column = std::make_shared<ValueColumn<int32_t>>();
+  int_column->append(1);
+  auto other_int_column = std::make_shared<ValueColumn<int32_t>>();
+  EXPECT_THROW(AdaptiveRadixTreeIndex({}), std::logic_error);
+  EXPECT_THROW(AdaptiveRadixTreeIndex({int_column, other_int_column}), std::logic_error);
+
+  const auto empty_index = AdaptiveRadixTreeIndex({other_int_column});
+  EXPECT_EQ(empty_index.lower_bound({1}), empty_index.cend());
+  EXPECT_EQ(empty_index.upper_bound({1}), empty_index.cend());
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, UsedByTableScan) {
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "string");
+  table->add_column("b", "int");
+  for (int i = 0; i < 12; ++i) table->append({std::to_string(i % 5), i});
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id).create_index<AdaptiveRadixTreeIndex>({ColumnID{0}, ColumnID{1}});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto equals_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, "3");
+  equals_scan->execute();
+  EXPECT_EQ(equals_scan->get_output()->row_count(), 2u);
+
+  auto range_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, "1");
+  range_scan->execute();
+  EXPECT_EQ(range_scan->get_output()->row_count(), 6u);
+
+  // rows appended after the index was created are still found
+  table->append({"3", 12});
+  auto scan_after_append = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, "3");
+  scan_after_append->execute();
+  EXPECT_EQ(scan_after_append->get_output()->row_count(), 3u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, NullValues) {
+  auto first_column = std::make_shared<ValueColumn<int>>(true);
+  auto second_column = std::make_shared<ValueColumn<std::string>>(true);
+  for (const auto& value : std::vector<AllTypeVariant>{3, NULL_VALUE, 1, 2}) first_column->append(value);
+  for (const auto& value : std::vector<AllTypeVariant>{"a", "b", NULL_VALUE, "c"}) second_column->append(value);
+
+  // rows with a NULL in any indexed column are left out
+  AdaptiveRadixTreeIndex index({first_column, std::make_shared<DictionaryColumn<std::string>>(second_column)});
+  EXPECT_EQ(std::vector<ChunkOffset>(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{3, 0}));
+  EXPECT_EQ(index.row_count(), 4u);
+}
+
+TEST_F(StorageAdaptiveRadixTreeIndexTest, NaNAndNegativeZero) {
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  auto value_column = std::make_shared<ValueColumn<float>>();
+  for (const auto value : {1.0f, nan, -0.0f, 0.0f, -nan}) value_column->append(value);
+
+  // NaNs are not ordered and therefore left out, -0.0 equals 0.0
+  for (const auto& column : std::vector<std::shared_ptr<const BaseColumn>>{
+           value_column, std::make_shared<RunLengthColumn<float>>(value_column)}) {
+    AdaptiveRadixTreeIndex index({column});
+    EXPECT_EQ(offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{2, 3, 0}));
+    EXPECT_EQ(offsets(index.lower_bound({0.0f}), index.upper_bound({0.0f})), (std::vector<ChunkOffset>{2, 3}));
+    EXPECT_EQ(offsets(index.lower_bound({-0.0f}), index.upper_bound({-0.0f})), (std::vector<ChunkOffset>{2, 3}));
+    EXPECT_EQ(index.row_count(), 5u);
+  }
+}
+
+}  // namespace opossum
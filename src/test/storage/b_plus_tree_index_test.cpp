@@ -0,0 +1,158 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/index/b_plus_tree/b_plus_tree_index.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/table_inserter.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/utils/compare_by_scan_type.hpp"
+
+namespace opossum {
+
+class StorageBPlusTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+  }
+
+  // returns the RowIDs of all rows whose first column compares to the search value as given by the scan type
+  PosList expected_rows(const ScanType scan_type, const int32_t search_value) {
+    PosList pos_list;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto value = type_cast<int32_t>((*chunk.get_column(ColumnID{0}))[chunk_offset]);
+        if (compare_by_scan_type(scan_type, value, search_value)) pos_list.push_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StorageBPlusTreeIndexTest, ScanAllScanTypes) {
+  const auto index = table->create_table_index({ColumnID{0}});
+  EXPECT_EQ(table->get_table_index(ColumnID{0}), index);
+  EXPECT_EQ(table->get_table_index(ColumnID{1}), nullptr);
+
+  // enough rows to split leaves and inner nodes
+  for (int32_t row = 0; row < 10'000; ++row) table->append({(row * 7919) % 1000 - 500, std::to_string(row)});
+  EXPECT_EQ(index->size(), 10'000u);
+
+  for (const auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan,
+                               ScanType::OpLessThanEquals, ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    for (const auto search_value : {-501, -500, -3, 0, 42, 499, 500}) {
+      EXPECT_EQ(*index->scan(scan_type, {search_value}), expected_rows(scan_type, search_value));
+    }
+  }
+}
+
+TEST_F(StorageBPlusTreeIndexTest, MultipleColumns) {
+  table->append({1, "b"});
+  table->append({2, "a"});
+  table->append({1, "a"});
+  table->append({1, "b"});
+  const auto index = table->create_table_index({ColumnID{0}, ColumnID{1}});
+  EXPECT_EQ(index->column_ids(), (std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}));
+
+  const auto row = [](const ChunkOffset chunk_offset) { return RowID{ChunkID{0}, chunk_offset}; };
+  EXPECT_EQ(*index->scan(ScanType::OpEquals, {1, "b"}), (PosList{row(0), row(3)}));
+  EXPECT_EQ(*index->scan(ScanType::OpLessThan, {1, "b"}), (PosList{row(2)}));
+  EXPECT_EQ(*index->scan(ScanType::OpGreaterThan, {1, "a"}), (PosList{row(0), row(1), row(3)}));
+  EXPECT_EQ(*index->scan(ScanType::OpEquals, {1}), (PosList{row(0), row(2), row(3)}));
+  EXPECT_EQ(*index->scan(ScanType::OpNotEquals, {1}), (PosList{row(1)}));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, MaintainedByTable) {
+  const auto index = table->create_table_index({ColumnID{1}});
+
+  table->append_columns(std::vector<int32_t>(150, 1), std::vector<std::string>(150, "bulk"));
+  {
+    TableInserter inserter(*table);
+    for (int32_t row = 0; row < 30; ++row) inserter.append({row, "inserted"});
+  }
+  table->append({0, "bulk"});
+
+  EXPECT_EQ(index->size(), table->row_count());
+  EXPECT_EQ(index->scan(ScanType::OpEquals, {"bulk"})->size(), 151u);
+  EXPECT_EQ(index->scan(ScanType::OpEquals, {"inserted"})->size(), 30u);
+
+  // RowIDs stay valid when chunks are compressed
+  const auto rows_before = *index->scan(ScanType::OpEquals, {"inserted"});
+  table->compress_chunks(ChunkID{0}, table->chunk_count(), 1);
+  EXPECT_EQ(*index->scan(ScanType::OpEquals, {"inserted"}), rows_before);
+  for (const auto& row_id : rows_before) {
+    EXPECT_EQ(type_cast<std::string>((*table->get_chunk(row_id.chunk_id).get_column(ColumnID{1}))[row_id.chunk_offset]),
+              "inserted");
+  }
+}
+
+TEST_F(StorageBPlusTreeIndexTest, UsedByTableScan) {
+  for (int32_t row = 0; row < 1'000; ++row) table->append({row % 10, "row"});
+  table->create_table_index({ColumnID{0}});
+  table->compress_chunks(ChunkID{0}, table->chunk_count(), 1);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 2);
+  table_scan->execute();
+  const auto output = table_scan->get_output();
+  EXPECT_EQ(output->row_count(), 200u);
+
+  const auto reference_column =
+      std::dynamic_pointer_cast<const ReferenceColumn>(output->get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  ASSERT_NE(reference_column, nullptr);
+  EXPECT_EQ(*reference_column->pos_list(), expected_rows(ScanType::OpLessThan, 2));
+}
+
+TEST_F(StorageBPlusTreeIndexTest, NullValues) {
+  auto nullable_table = std::make_shared<Table>(10);
+  nullable_table->add_column("a", "int", true);
+  for (int32_t row = 0; row < 30; ++row) nullable_table->append({row % 3 == 0 ? NULL_VALUE : AllTypeVariant{row}});
+  nullable_table->compress_chunk(ChunkID{0});
+  const auto index = nullable_table->create_table_index({ColumnID{0}});
+
+  // NULL rows are not stored in the tree, but count towards its size so that it is used by scans
+  EXPECT_EQ(index->size(), 30u);
+  EXPECT_EQ(index->scan(ScanType::OpLessThan, {5})->size(), 3u);
+  EXPECT_EQ(index->scan(ScanType::OpNotEquals, {5})->size(), 19u);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(nullable_table);
+  table_wrapper->execute();
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 20u);
+}
+
+TEST_F(StorageBPlusTreeIndexTest, NaNAndNegativeZero) {
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  auto double_table = std::make_shared<Table>(10);
+  double_table->add_column("a", "double");
+  for (const auto value : {1.0, nan, -0.0, 0.0, -1.0}) double_table->append({value});
+  const auto index = double_table->create_table_index({ColumnID{0}});
+
+  // NaN rows are not stored in the tree, but count towards its size, -0.0 equals 0.0
+  EXPECT_EQ(index->size(), 5u);
+  EXPECT_EQ(*index->scan(ScanType::OpEquals, {0.0}), (PosList{RowID{ChunkID{0}, 2}, RowID{ChunkID{0}, 3}}));
+  EXPECT_EQ(*index->scan(ScanType::OpLessThan, {-0.0}), (PosList{RowID{ChunkID{0}, 4}}));
+  EXPECT_EQ(index->scan(ScanType::OpGreaterThanEquals, {-1.0})->size(), 4u);
+
+  // a NaN search value only satisfies OpNotEquals
+  EXPECT_EQ(index->scan(ScanType::OpEquals, {nan})->size(), 0u);
+  EXPECT_EQ(index->scan(ScanType::OpGreaterThan, {nan})->size(), 0u);
+  EXPECT_EQ(index->scan(ScanType::OpNotEquals, {nan})->size(), 4u);
+}
+
+}  // namespace opossum
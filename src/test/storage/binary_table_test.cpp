@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/binary_table.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/fitted_attribute_vector.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/string_dictionary.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBinaryTableTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = std::make_shared<Table>(100);
+    table->add_column("a", "int", true);
+    table->add_column("b", "long");
+    table->add_column("c", "float");
+    table->add_column("d", "string", true);
+    for (int i = 0; i < 450; ++i) {
+      const auto a = i % 7 == 0 ? NULL_VALUE : AllTypeVariant{i / 3};
+      const auto d = i % 11 == 0 ? NULL_VALUE : AllTypeVariant{"value " + std::to_string(i % 40)};
+      table->append({a, int64_t{i} * 1000, static_cast<float>(i) / 4, d});
+    }
+
+    // the last chunk stays unencoded
+    table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{2}, EncodingType::FrameOfReference);
+  }
+
+  void TearDown() override { std::remove(file_name.c_str()); }
+
+  std::string read_file() const {
+    std::ifstream file(file_name, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  }
+
+  void overwrite_file(const std::string& content) const {
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), content.size());
+  }
+
+  // returns the message of the exception thrown by map_binary_table
+  std::string map_error() const {
+    try {
+      map_binary_table(file_name);
+    } catch (const std::logic_error& error) {
+      return error.what();
+    }
+    return "";
+  }
+
+  std::shared_ptr<Table> table;
+  const std::string file_name = testing::TempDir() + "storage_binary_table_test.bin";
+};
+
+TEST_F(StorageBinaryTableTest, RoundTrip) {
+  write_binary_table(*table, file_name);
+  const auto loaded_table = map_binary_table(file_name);
+
+  EXPECT_TABLE_EQ(loaded_table, table, true);
+  EXPECT_EQ(loaded_table->chunk_size(), 100u);
+  EXPECT_EQ(loaded_table->chunk_count(), 5u);
+  EXPECT_TRUE(loaded_table->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(loaded_table->column_is_nullable(ColumnID{1}));
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (ColumnID column_id{0}; column_id < table->col_count(); ++column_id) {
+      const auto& column = *table->get_chunk(chunk_id).get_column(column_id);
+      const auto& loaded_column = *loaded_table->get_chunk(chunk_id).get_column(column_id);
+      EXPECT_EQ(loaded_column.encoding_name(), column.encoding_name());
+      EXPECT_EQ(loaded_column.match_zone_map(ScanType::OpLessThan, 10),
+                column.match_zone_map(ScanType::OpLessThan, 10));
+    }
+  }
+}
+
+TEST_F(StorageBinaryTableTest, EncodedColumnsReferToMappedFile) {
+  write_binary_table(*table, file_name);
+  auto loaded_table = map_binary_table(file_name);
+
+  const auto& dictionary_column =
+      dynamic_cast<const DictionaryColumn<int64_t>&>(*loaded_table->get_chunk(ChunkID{0}).get_column(ColumnID{1}));
+  EXPECT_TRUE(dictionary_column.dictionary()->is_external());
+  // 100 distinct values need 7 bits per value id
+  const auto& attribute_vector = dynamic_cast<const BitPackedAttributeVector&>(*dictionary_column.attribute_vector());
+  EXPECT_TRUE(attribute_vector.words().is_external());
+
+  const auto& string_column =
+      dynamic_cast<const DictionaryColumn<std::string>&>(*loaded_table->get_chunk(ChunkID{0}).get_column(ColumnID{3}));
+  EXPECT_TRUE(string_column.dictionary()->data().is_external());
+  EXPECT_EQ(string_column.lower_bound(std::string{"value 2"}), ValueID{12});
+
+  const auto& frame_of_reference_column = dynamic_cast<const FrameOfReferenceColumn<int64_t>&>(
+      *loaded_table->get_chunk(ChunkID{2}).get_column(ColumnID{1}));
+  EXPECT_TRUE(frame_of_reference_column.offsets()->words().is_external());
+
+  // the mapping stays valid as long as a column refers to it
+  auto column = loaded_table->get_chunk(ChunkID{2}).get_column(ColumnID{1});
+  loaded_table.reset();
+  std::remove(file_name.c_str());
+  EXPECT_EQ(type_cast<int64_t>((*column)[5]), 205000);
+}
+
+TEST_F(StorageBinaryTableTest, RejectsInvalidFiles) {
+  EXPECT_THROW(map_binary_table(file_name), std::logic_error);
+
+  {
+    std::ofstream file(file_name);
+    file << "a|b\nint|int\n1|2\n";
+  }
+  EXPECT_THROW(map_binary_table(file_name), std::logic_error);
+
+  // a truncated file is detected instead of reading past the mapping
+  write_binary_table(*table, file_name);
+  const auto truncated_file_name = file_name + ".truncated";
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    std::ofstream out(truncated_file_name, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    out.write(content.data(), content.size() / 2);
+  }
+  EXPECT_THROW(map_binary_table(truncated_file_name), std::logic_error);
+  std::remove(truncated_file_name.c_str());
+}
+
+TEST_F(StorageBinaryTableTest, RejectsOtherByteOrderBeforeVersion) {
+  write_binary_table(*table, file_name);
+  auto content = read_file();
+  // a machine with the other byte order writes both the version and the byte order mark reversed
+  std::reverse(content.begin() + 8, content.begin() + 12);
+  std::reverse(content.begin() + 12, content.begin() + 16);
+  overwrite_file(content);
+  EXPECT_NE(map_error().find("different byte order"), std::string::npos);
+}
+
+TEST_F(StorageBinaryTableTest, RejectsDecreasingStringOffsets) {
+  auto strings = std::make_shared<Table>();
+  strings->add_column("s", "string");
+  strings->append({"abc"});
+  strings->append({"d"});
+  write_binary_table(*strings, file_name);
+
+  // the offsets 0, 3, 4 of the value column become 0, 5, 4
+  const uint64_t offsets[] = {0, 3, 4};
+  auto content = read_file();
+  const auto position = content.find(std::string(reinterpret_cast<const char*>(offsets), sizeof(offsets)));
+  ASSERT_NE(position, std::string::npos);
+  const uint64_t decreasing_offset = 5;
+  content.replace(position + sizeof(uint64_t), sizeof(uint64_t),
+                  std::string(reinterpret_cast<const char*>(&decreasing_offset), sizeof(uint64_t)));
+  overwrite_file(content);
+  EXPECT_NE(map_error().find("invalid strings"), std::string::npos);
+
+  // the same applies to the offsets of a string dictionary
+  Chunk chunk;
+  chunk.add_column(std::make_shared<DictionaryColumn<std::string>>(
+      std::make_shared<StringDictionary>(ColumnBuffer<char>(std::pmr::vector<char>{'a', 'b', 'c', 'd'}),
+                                         ColumnBuffer<uint32_t>(std::pmr::vector<uint32_t>{0, 3, 2, 4})),
+      std::make_shared<FittedAttributeVector<uint8_t>>(ColumnBuffer<uint8_t>(std::pmr::vector<uint8_t>{0, 1, 2})),
+      std::nullopt));
+  auto dictionary_strings = std::make_shared<Table>();
+  dictionary_strings->add_column_definition("s", "string");
+  dictionary_strings->emplace_chunk(std::move(chunk));
+  write_binary_table(*dictionary_strings, file_name);
+  EXPECT_NE(map_error().find("invalid strings"), std::string::npos);
+}
+
+TEST_F(StorageBinaryTableTest, RejectsValueIdsOutsideOfDictionary) {
+  const auto write_value_ids = [&](std::pmr::vector<uint8_t> value_ids) {
+    Chunk chunk;
+    chunk.add_column(std::make_shared<DictionaryColumn<int>>(
+        std::make_shared<ColumnBuffer<int>>(std::pmr::vector<int>{10, 20}),
+        std::make_shared<FittedAttributeVector<uint8_t>>(ColumnBuffer<uint8_t>(std::move(value_ids))),
+        std::nullopt));
+    auto dictionary_table = std::make_shared<Table>();
+    dictionary_table->add_column_definition("a", "int");
+    dictionary_table->emplace_chunk(std::move(chunk));
+    write_binary_table(*dictionary_table, file_name);
+  };
+
+  // the value id after the last dictionary entry is the NULL value id
+  write_value_ids({0, 1, 2});
+  EXPECT_EQ(map_error(), "");
+
+  write_value_ids({0, 3, 1});
+  EXPECT_NE(map_error().find("outside of the dictionary"), std::string::npos);
+}
+
+TEST_F(StorageBinaryTableTest, RejectsRunEndsThatAreNotIncreasing) {
+  const auto write_run_ends = [&](std::vector<ChunkOffset> end_positions) {
+    Chunk chunk;
+    chunk.add_column(std::make_shared<RunLengthColumn<int>>(std::vector<int>{10, 20}, std::move(end_positions),
+                                                            ZoneMap<int>{}, std::nullopt));
+    auto run_length_table = std::make_shared<Table>();
+    run_length_table->add_column_definition("a", "int");
+    run_length_table->emplace_chunk(std::move(chunk));
+    write_binary_table(*run_length_table, file_name);
+  };
+
+  write_run_ends({1, 3});
+  EXPECT_EQ(map_error(), "");
+
+  // the last run end is the size of the column, so it matches the chunk in all of these
+  write_run_ends({10, 3});
+  EXPECT_NE(map_error().find("not strictly increasing"), std::string::npos);
+
+  write_run_ends({3, 3});
+  EXPECT_NE(map_error().find("not strictly increasing"), std::string::npos);
+
+  write_run_ends({0, 3});
+  EXPECT_NE(map_error().find("not strictly increasing"), std::string::npos);
+}
+
+}  // namespace opossum
@@ -0,0 +1,89 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageBitPackedAttributeVectorTest : public BaseTest {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, BitWidthFor) {
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(0), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(1), 1u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(5), 3u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(255), 8u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(256), 9u);
+  EXPECT_EQ(BitPackedAttributeVector::bit_width_for(std::numeric_limits<uint32_t>::max()), 32u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetAndGetAllWidths) {
+  // 200 values cover several full blocks as well as values that span two words
+  for (uint8_t bit_width = 1; bit_width <= 32; ++bit_width) {
+    BitPackedAttributeVector attribute_vector(200, bit_width);
+    EXPECT_EQ(attribute_vector.size(), 200u);
+    EXPECT_EQ(attribute_vector.bit_width(), bit_width);
+
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    for (size_t i = 0; i < 200; ++i) {
+      attribute_vector.set(i, ValueID{static_cast<uint32_t>((i * 2654435761u) & max_value)});
+    }
+
+    for (size_t i = 0; i < 200; ++i) {
+      EXPECT_EQ(attribute_vector.get(i), ValueID{static_cast<uint32_t>((i * 2654435761u) & max_value)});
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, OverwriteDoesNotAffectNeighbours) {
+  BitPackedAttributeVector attribute_vector(64, 5);
+  for (size_t i = 0; i < 64; ++i) attribute_vector.set(i, ValueID{31});
+
+  attribute_vector.set(12, ValueID{0});
+  EXPECT_EQ(attribute_vector.get(11), ValueID{31});
+  EXPECT_EQ(attribute_vector.get(12), ValueID{0});
+  EXPECT_EQ(attribute_vector.get(13), ValueID{31});
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, GetRange) {
+  for (uint8_t bit_width : {1, 3, 7, 13, 32}) {
+    BitPackedAttributeVector attribute_vector(300, bit_width);
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    for (size_t i = 0; i < 300; ++i) attribute_vector.set(i, ValueID{static_cast<uint32_t>(i & max_value)});
+
+    // unaligned start, several full blocks and a tail
+    std::vector<ValueID> decoded(250);
+    attribute_vector.get_range(17, 250, decoded.data());
+    for (size_t i = 0; i < 250; ++i) {
+      EXPECT_EQ(decoded[i], attribute_vector.get(17 + i));
+    }
+  }
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Width) {
+  EXPECT_EQ(BitPackedAttributeVector(10, 3).width(), 1u);
+  EXPECT_EQ(BitPackedAttributeVector(10, 9).width(), 2u);
+  EXPECT_EQ(BitPackedAttributeVector(10, 17).width(), 3u);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, UsedByDictionaryColumn) {
+  auto value_column = std::make_shared<ValueColumn<int32_t>>();
+  for (int32_t i = 0; i < 1000; ++i) value_column->append(i % 5);
+
+  DictionaryColumn<int32_t> dictionary_column(value_column);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const BitPackedAttributeVector>(dictionary_column.attribute_vector());
+  ASSERT_NE(attribute_vector, nullptr);
+  EXPECT_EQ(attribute_vector->bit_width(), 3u);
+
+  for (size_t i = 0; i < 1000; ++i) {
+    EXPECT_EQ(dictionary_column.get(i), static_cast<int32_t>(i % 5));
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/bloom_filter.hpp"
+#include "../lib/storage/storage_manager.hpp"
+#include "../lib/storage/table.hpp"
+
+namespace opossum {
+
+class StorageBloomFilterTest : public BaseTest {};
+
+TEST_F(StorageBloomFilterTest, NoFalseNegatives) {
+  BlockedBloomFilter bloom_filter(1000);
+  EXPECT_EQ(bloom_filter.memory_usage() % 64, 0u);
+  EXPECT_GE(bloom_filter.memory_usage(), 1000u * 10 / 8);
+  EXPECT_EQ(bloom_filter.false_positive_rate(), 0.0);
+
+  for (int32_t value = 0; value < 1000; ++value) bloom_filter.insert(bloom_filter_hash(value));
+  for (int32_t value = 0; value < 1000; ++value) EXPECT_TRUE(bloom_filter.may_contain(bloom_filter_hash(value)));
+}
+
+TEST_F(StorageBloomFilterTest, FalsePositiveRate) {
+  BlockedBloomFilter bloom_filter(10'000);
+  for (int64_t value = 0; value < 10'000; ++value) bloom_filter.insert(bloom_filter_hash(value));
+
+  auto false_positives = 0;
+  for (int64_t value = 10'000; value < 110'000; ++value) {
+    if (bloom_filter.may_contain(bloom_filter_hash(value))) ++false_positives;
+  }
+
+  // a blocked filter with 10 bits per value has a false-positive rate of about 1%
+  const auto measured_rate = false_positives / 100'000.0;
+  EXPECT_LT(measured_rate, 0.03);
+  EXPECT_NEAR(bloom_filter.false_positive_rate(), measured_rate, 0.01);
+}
+
+TEST_F(StorageBloomFilterTest, HashOfEqualValues) {
+  const auto value = std::string("customer#42");
+  EXPECT_EQ(bloom_filter_hash(value), bloom_filter_hash(std::string_view(value)));
+  EXPECT_EQ(bloom_filter_hash(0.0), bloom_filter_hash(-0.0));
+  EXPECT_EQ(bloom_filter_hash(1.5f), bloom_filter_hash(1.5));
+  EXPECT_NE(bloom_filter_hash(int32_t{1}), bloom_filter_hash(int32_t{2}));
+}
+
+TEST_F(StorageBloomFilterTest, BuiltOnCompression) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("id", "int");
+  table->add_column("name", "string");
+  table->enable_bloom_filters();
+  for (int32_t row = 0; row < 1'000; ++row) table->append({row, "customer#" + std::to_string(row * 7)});
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).get_bloom_filter(ColumnID{1}), nullptr);
+  table->compress_chunks(ChunkID{0}, ChunkID{9}, 1);
+  table->compress_chunk(ChunkID{9}, EncodingType::RunLength);
+
+  auto chunks_with_match = 0;
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto bloom_filter = table->get_chunk(chunk_id).get_bloom_filter(ColumnID{1});
+    ASSERT_NE(bloom_filter, nullptr);
+    if (bloom_filter->may_contain(bloom_filter_hash(std::string("customer#700")))) ++chunks_with_match;
+  }
+  EXPECT_LT(chunks_with_match, 3);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  for (const auto& [search_value, row_count] : std::vector<std::pair<std::string, uint64_t>>{
+           {"customer#700", 1}, {"customer#6993", 1}, {"customer#701", 0}}) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpEquals, search_value);
+    table_scan->execute();
+    EXPECT_EQ(table_scan->get_output()->row_count(), row_count);
+
+    // the filters are also used when scanning the result of another scan
+    auto wrapped_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+    wrapped_scan->execute();
+    auto second_scan = std::make_shared<TableScan>(wrapped_scan, ColumnID{1}, ScanType::OpEquals, search_value);
+    second_scan->execute();
+    EXPECT_EQ(second_scan->get_output()->row_count(), row_count);
+  }
+
+  StorageManager::get().add_table("customers", table);
+  std::stringstream output;
+  StorageManager::get().print(output);
+  EXPECT_NE(output.str().find("#bloom filters:20 ("), std::string::npos);
+}
+
+}  // namespace opossum
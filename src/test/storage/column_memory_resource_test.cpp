@@ -0,0 +1,76 @@
+#include <memory>
+#include <memory_resource>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/column_memory_resource.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+// forwards to the global heap and counts the bytes that are currently allocated
+class CountingMemoryResource : public std::pmr::memory_resource {
+ public:
+  size_t allocated_bytes = 0;
+
+ protected:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    allocated_bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* pointer, size_t bytes, size_t alignment) override {
+    allocated_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+class StorageColumnMemoryResourceTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (int i = 0; i < 1000; ++i) {
+      int_column->append(i % 300);
+      string_column->append("value " + std::to_string(i % 300));
+    }
+  }
+
+  std::shared_ptr<ValueColumn<int32_t>> int_column = std::make_shared<ValueColumn<int32_t>>();
+  std::shared_ptr<ValueColumn<std::string>> string_column = std::make_shared<ValueColumn<std::string>>();
+  CountingMemoryResource memory_resource;
+};
+
+TEST_F(StorageColumnMemoryResourceTest, DictionaryColumnUsesGivenResource) {
+  {
+    DictionaryColumn<int32_t> int_dictionary_column(int_column, &memory_resource);
+    // 300 distinct values of 4 bytes each and 1000 value ids of 2 bytes each
+    EXPECT_GE(memory_resource.allocated_bytes, 300u * 4u + 1000u * 2u);
+    EXPECT_EQ(int_dictionary_column.get(301), 1);
+
+    const auto int_bytes = memory_resource.allocated_bytes;
+    DictionaryColumn<std::string> string_dictionary_column(string_column, &memory_resource);
+    EXPECT_GT(memory_resource.allocated_bytes, int_bytes);
+    EXPECT_EQ(string_dictionary_column.get(301), "value 1");
+  }
+  EXPECT_EQ(memory_resource.allocated_bytes, 0u);
+}
+
+TEST_F(StorageColumnMemoryResourceTest, ReplaceDefaultResource) {
+  const auto previous = set_column_memory_resource(&memory_resource);
+  EXPECT_EQ(column_memory_resource(), &memory_resource);
+
+  auto dictionary_column = std::make_shared<DictionaryColumn<int32_t>>(int_column);
+  EXPECT_GT(memory_resource.allocated_bytes, 0u);
+
+  EXPECT_EQ(set_column_memory_resource(previous), &memory_resource);
+  EXPECT_EQ(column_memory_resource(), previous);
+
+  dictionary_column = nullptr;
+  EXPECT_EQ(memory_resource.allocated_bytes, 0u);
+}
+
+}  // namespace opossum
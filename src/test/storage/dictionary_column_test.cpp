@@ -62,6 +62,18 @@ TEST_F(StorageDictionaryColumnTest, LowerUpperBound) {
   EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
 }
 
+TEST_F(StorageDictionaryColumnTest, StringLowerUpperBound) {
+  for (auto value : {"Bill", "Steve", "Alexander", "Hasso"}) vc_str->append(value);
+  auto dict_col = std::make_shared<opossum::DictionaryColumn<std::string>>(vc_str);
+
+  EXPECT_EQ(dict_col->value_by_value_id(opossum::ValueID{2}), "Hasso");
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Bill"}), (opossum::ValueID)1);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Bill"}), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Carl"}), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Zed"}), opossum::INVALID_VALUE_ID);
+  EXPECT_EQ(dict_col->get(3), "Hasso");
+}
+
 TEST_F(StorageDictionaryColumnTest, ValueIDWidth) {
   for (int32_t value = 0; value <= 10; ++value) vc_int->append(value);
 
@@ -101,4 +113,26 @@ TEST_F(StorageDictionaryColumnTest, ThrowOnAppendToDictCol) {
   EXPECT_THROW((dict_col->append("Philipp")), std::exception);
 }
 
+TEST_F(StorageDictionaryColumnTest, NullValues) {
+  auto vc_nullable = std::make_shared<opossum::ValueColumn<std::string>>(true);
+  vc_nullable->append("Bill");
+  vc_nullable->append(opossum::NULL_VALUE);
+  vc_nullable->append("Alexander");
+  vc_nullable->append(opossum::NULL_VALUE);
+
+  auto col = opossum::make_shared_by_column_type<opossum::BaseColumn, opossum::DictionaryColumn>("string", vc_nullable);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionaryColumn<std::string>>(col);
+
+  // NULL is not part of the dictionary but gets the value id after its last entry
+  EXPECT_EQ(dict_col->unique_values_count(), 2u);
+  EXPECT_EQ(dict_col->null_value_id(), opossum::ValueID{2});
+  EXPECT_EQ(dict_col->attribute_vector()->get(1), opossum::ValueID{2});
+  EXPECT_EQ(dict_col->attribute_vector()->get(2), opossum::ValueID{0});
+
+  EXPECT_EQ(dict_col->validity()->null_count(), 2u);
+  EXPECT_TRUE(opossum::variant_is_null((*dict_col)[3]));
+  EXPECT_EQ(opossum::type_cast<std::string>((*dict_col)[0]), "Bill");
+  EXPECT_EQ(dict_col->zone_map().min(), "Alexander");
+}
+
 // TODO(student): You should add some more tests here (full coverage would be appreciated) and possibly in other files.
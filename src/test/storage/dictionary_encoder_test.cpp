@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_encoder.hpp"
+
+namespace opossum {
+
+class StorageDictionaryEncoderTest : public BaseTest {};
+
+TEST_F(StorageDictionaryEncoderTest, EncodeStrings) {
+  const auto encoding = dictionary_encode(std::vector<std::string>{"Bill", "Steve", "Alexander", "Steve", "Hasso"});
+
+  EXPECT_EQ(encoding.dictionary, (std::vector<std::string>{"Alexander", "Bill", "Hasso", "Steve"}));
+  EXPECT_EQ(encoding.value_ids, (std::vector<ValueID>{ValueID{1}, ValueID{3}, ValueID{0}, ValueID{3}, ValueID{2}}));
+}
+
+TEST_F(StorageDictionaryEncoderTest, EncodeEmpty) {
+  const auto encoding = dictionary_encode(std::vector<double>{});
+  EXPECT_TRUE(encoding.dictionary.empty());
+  EXPECT_TRUE(encoding.value_ids.empty());
+}
+
+TEST_F(StorageDictionaryEncoderTest, EncodeManyValues) {
+  // enough distinct values to grow the hash table several times, with strided values that collide without mixing
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 20000; ++i) values.push_back(((i * 7919) % 5000) * 1024 - 100000);
+
+  const auto encoding = dictionary_encode(values);
+  ASSERT_EQ(encoding.dictionary.size(), 5000u);
+  EXPECT_TRUE(std::is_sorted(encoding.dictionary.begin(), encoding.dictionary.end()));
+
+  for (size_t index = 0; index < values.size(); ++index) {
+    EXPECT_EQ(encoding.dictionary[encoding.value_ids[index]], values[index]);
+  }
+}
+
+TEST_F(StorageDictionaryEncoderTest, EncodeNaN) {
+  // NaNs with different signs and payloads share one entry after all ordered values, -0.0 equals 0.0
+  const auto nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> values;
+  for (int i = 0; i < 100; ++i) {
+    for (const auto value : {3.0, nan, -1.0, -nan, 0.0, -0.0, std::nan("1"), 2.5}) values.push_back(value + i % 7);
+  }
+
+  const auto encoding = dictionary_encode(values);
+  ASSERT_EQ(encoding.dictionary.size(), 19u);
+  EXPECT_TRUE(std::isnan(encoding.dictionary.back()));
+  EXPECT_TRUE(std::is_sorted(encoding.dictionary.begin(), encoding.dictionary.end() - 1));
+  EXPECT_FALSE(std::any_of(encoding.dictionary.begin(), encoding.dictionary.end() - 1,
+                           [](const double value) { return std::isnan(value); }));
+
+  for (size_t index = 0; index < values.size(); ++index) {
+    if (std::isnan(values[index])) {
+      EXPECT_EQ(encoding.value_ids[index], ValueID{18});
+    } else {
+      EXPECT_EQ(encoding.dictionary[encoding.value_ids[index]], values[index]);
+    }
+  }
+}
+
+}  // namespace opossum
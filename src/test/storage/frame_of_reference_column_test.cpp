@@ -0,0 +1,152 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/type_cast.hpp"
+#include "../lib/utils/compare_by_scan_type.hpp"
+
+namespace opossum {
+
+class StorageFrameOfReferenceColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // two full blocks and a partial one, with values around an epoch timestamp
+    for (int64_t i = 0; i < 5000; ++i) vc_long->append(int64_t{1500000000} + (i % 100) - 50);
+  }
+
+  std::shared_ptr<ValueColumn<int64_t>> vc_long = std::make_shared<ValueColumn<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressColumn) {
+  FrameOfReferenceColumn<int64_t> for_col(vc_long);
+
+  EXPECT_EQ(for_col.size(), 5000u);
+  EXPECT_EQ(for_col.block_minima().size(), 3u);
+  EXPECT_EQ(for_col.block_minima()[0], 1500000000 - 50);
+  EXPECT_EQ(for_col.offsets()->bit_width(), 7u);
+
+  for (auto i = 0u; i < vc_long->size(); ++i) {
+    EXPECT_EQ(for_col.get(i), vc_long->values()[i]);
+  }
+  EXPECT_EQ(type_cast<int64_t>(for_col[42]), vc_long->values()[42]);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, NegativeValues) {
+  auto vc_int = std::make_shared<ValueColumn<int32_t>>();
+  for (auto value : {-5, std::numeric_limits<int32_t>::min(), 0, -1}) vc_int->append(value);
+
+  // the range of this block exceeds the positive range of int32_t, but the offsets still fit into 32 bits
+  FrameOfReferenceColumn<int32_t> for_col(vc_int);
+  EXPECT_EQ(for_col.get(0), -5);
+  EXPECT_EQ(for_col.get(1), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(for_col.get(2), 0);
+  EXPECT_EQ(for_col.get(3), -1);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, ThrowOnTooWideRange) {
+  auto vc_wide = std::make_shared<ValueColumn<int64_t>>();
+  vc_wide->append(int64_t{0});
+  vc_wide->append(std::numeric_limits<int64_t>::max());
+  EXPECT_FALSE(FrameOfReferenceColumn<int64_t>::is_encodable(vc_wide));
+  EXPECT_THROW(FrameOfReferenceColumn<int64_t>{vc_wide}, std::logic_error);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, ThrowOnAppend) {
+  FrameOfReferenceColumn<int64_t> for_col(vc_long);
+  EXPECT_THROW(for_col.append(int64_t{1}), std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, Scan) {
+  FrameOfReferenceColumn<int64_t> for_col(vc_long);
+  const auto& values = vc_long->values();
+
+  for (auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpLessThanEquals,
+                         ScanType::OpGreaterThan, ScanType::OpGreaterThanEquals}) {
+    // below, inside, and above the value range of all blocks
+    for (int64_t search_value : {int64_t{0}, int64_t{1500000000}, int64_t{1500000049}, int64_t{2000000000}}) {
+      PosList pos_list;
+      for_col.scan(scan_type, search_value, ChunkID{1}, pos_list);
+
+      PosList expected;
+      for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+        if (compare_by_scan_type(scan_type, values[chunk_offset], search_value)) {
+          expected.push_back(RowID{ChunkID{1}, chunk_offset});
+        }
+      }
+      EXPECT_EQ(pos_list, expected);
+    }
+  }
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressChunkOfTable) {
+  Table table;
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.append({100, "x"});
+  table.append({102, "y"});
+
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<FrameOfReferenceColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+  // non-integral columns fall back to dictionary encoding
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1})), nullptr);
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, CompressChunkWithTooWideRange) {
+  Table table;
+  table.add_column("a", "long");
+  table.append({int64_t{0}});
+  table.append({std::numeric_limits<int64_t>::max()});
+
+  table.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  // columns whose blocks do not fit into 32 bits fall back to dictionary encoding
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int64_t>>(chunk.get_column(ColumnID{0})), nullptr);
+  EXPECT_EQ(type_cast<int64_t>((*chunk.get_column(ColumnID{0}))[1]), std::numeric_limits<int64_t>::max());
+}
+
+TEST_F(StorageFrameOfReferenceColumnTest, NullValues) {
+  auto vc_nullable = std::make_shared<ValueColumn<int32_t>>(true);
+  for (int32_t i = 0; i < 3000; ++i) {
+    if (i % 7 == 0) {
+      vc_nullable->append(NULL_VALUE);
+    } else {
+      vc_nullable->append(1000 + i);
+    }
+  }
+  // the last block only consists of NULLs
+  for (int32_t i = 0; i < 100; ++i) vc_nullable->append(NULL_VALUE);
+
+  FrameOfReferenceColumn<int32_t> for_col(vc_nullable);
+  EXPECT_EQ(for_col.block_minima()[0], 1001);
+  EXPECT_EQ(for_col.zone_map().min(), 1001);
+  EXPECT_TRUE(variant_is_null(for_col[7]));
+  EXPECT_EQ(type_cast<int32_t>(for_col[2500]), 3500);
+
+  for (auto scan_type : {ScanType::OpEquals, ScanType::OpNotEquals, ScanType::OpLessThan, ScanType::OpGreaterThan}) {
+    for (int32_t search_value : {0, 1001, 2500, 5000}) {
+      PosList pos_list;
+      for_col.scan(scan_type, search_value, ChunkID{0}, pos_list);
+
+      PosList expected;
+      for (ChunkOffset chunk_offset = 0; chunk_offset < 3000; ++chunk_offset) {
+        if (chunk_offset % 7 != 0 && compare_by_scan_type(scan_type, int32_t(1000 + chunk_offset), search_value)) {
+          expected.push_back(RowID{ChunkID{0}, chunk_offset});
+        }
+      }
+      EXPECT_EQ(pos_list, expected);
+    }
+  }
+}
+
+}  // namespace opossum
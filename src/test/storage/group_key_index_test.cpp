@@ -0,0 +1,105 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/operators/table_scan.hpp"
+#include "../lib/operators/table_wrapper.hpp"
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageGroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_column = std::make_shared<ValueColumn<std::string>>();
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"}) {
+      value_column->append(value);
+    }
+    dictionary_column = std::make_shared<DictionaryColumn<std::string>>(value_column);
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>{dictionary_column});
+  }
+
+  std::vector<ChunkOffset> offsets(BaseIndex::Iterator begin, BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<DictionaryColumn<std::string>> dictionary_column;
+  std::shared_ptr<GroupKeyIndex> index;
+};
+
+TEST_F(StorageGroupKeyIndexTest, Postings) {
+  // offsets are ordered by value and, within a value, by offset
+  EXPECT_EQ(offsets(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{4, 5, 6, 1, 3, 2, 0, 7}));
+  EXPECT_EQ(index->indexed_columns(), (std::vector<std::shared_ptr<const BaseColumn>>{dictionary_column}));
+}
+
+TEST_F(StorageGroupKeyIndexTest, Bounds) {
+  EXPECT_EQ(offsets(index->lower_bound({"delta"}), index->upper_bound({"delta"})), (std::vector<ChunkOffset>{1, 3}));
+  EXPECT_EQ(offsets(index->lower_bound({"bravo"}), index->upper_bound({"bravo"})), std::vector<ChunkOffset>{});
+  EXPECT_EQ(offsets(index->lower_bound({"charlie"}), index->upper_bound({"frank"})),
+            (std::vector<ChunkOffset>{5, 6, 1, 3, 2}));
+
+  EXPECT_EQ(index->lower_bound({"apple"}), index->cbegin());
+  EXPECT_EQ(index->upper_bound({"inbox"}), index->cend());
+  EXPECT_EQ(index->lower_bound({"zulu"}), index->cend());
+}
+
+TEST_F(StorageGroupKeyIndexTest, RequiresDictionaryColumn) {
+  EXPECT_THROW(GroupKeyIndex({std::make_shared<ValueColumn<int>>()}), std::logic_error);
+  EXPECT_THROW(GroupKeyIndex({dictionary_column, dictionary_column}), std::logic_error);
+}
+
+TEST_F(StorageGroupKeyIndexTest, CreatedThroughChunk) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  for (int i = 0; i < 12; ++i) table->append({i % 5});
+  table->compress_chunks(ChunkID{0}, table->chunk_count(), 1);
+
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_EQ(chunk.get_index(ColumnID{0}), nullptr);
+    const auto index = chunk.create_index<GroupKeyIndex>({ColumnID{0}});
+    EXPECT_EQ(chunk.get_index(ColumnID{0}), index);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto equals_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, 3);
+  equals_scan->execute();
+  EXPECT_EQ(equals_scan->get_output()->row_count(), 2u);
+
+  auto range_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThanEquals, 1);
+  range_scan->execute();
+  EXPECT_EQ(range_scan->get_output()->row_count(), 6u);
+
+  auto not_equals_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 1);
+  not_equals_scan->execute();
+  EXPECT_EQ(not_equals_scan->get_output()->row_count(), 9u);
+
+  // replacing the column drops its index
+  auto value_column = std::make_shared<ValueColumn<int>>();
+  value_column->append_batch({0, 1, 2, 3});
+  auto& chunk = table->get_chunk(ChunkID{0});
+  chunk.replace_column(ColumnID{0}, std::make_shared<DictionaryColumn<int>>(value_column));
+  EXPECT_EQ(chunk.get_index(ColumnID{0}), nullptr);
+}
+
+TEST_F(StorageGroupKeyIndexTest, NullValues) {
+  auto value_column = std::make_shared<ValueColumn<int>>(true);
+  for (const auto& value : std::vector<AllTypeVariant>{2, NULL_VALUE, 1, 2, NULL_VALUE}) value_column->append(value);
+  const auto nullable_index = GroupKeyIndex({std::make_shared<DictionaryColumn<int>>(value_column)});
+
+  // NULL rows are not handed out, but counted
+  EXPECT_EQ(offsets(nullable_index.cbegin(), nullable_index.cend()), (std::vector<ChunkOffset>{2, 0, 3}));
+  EXPECT_EQ(nullable_index.upper_bound({2}), nullable_index.cend());
+  EXPECT_EQ(nullable_index.row_count(), 5u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+
+namespace opossum {
+
+class StorageRunLengthColumnTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto value : {1, 1, 1, 3, 3, 2, 2, 2, 2, 1}) vc_int->append(value);
+    for (auto value : {"a", "a", "b", "b", "b"}) vc_str->append(value);
+  }
+
+  std::shared_ptr<ValueColumn<int>> vc_int = std::make_shared<ValueColumn<int>>();
+  std::shared_ptr<ValueColumn<std::string>> vc_str = std::make_shared<ValueColumn<std::string>>();
+};
+
+TEST_F(StorageRunLengthColumnTest, CompressColumn) {
+  auto col = make_shared_by_column_type<BaseColumn, RunLengthColumn>("int", vc_int);
+  auto rl_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(col);
+
+  EXPECT_EQ(rl_col->size(), 10u);
+  EXPECT_EQ(rl_col->run_count(), 4u);
+  EXPECT_EQ(rl_col->values(), (std::vector<int>{1, 3, 2, 1}));
+  EXPECT_EQ(rl_col->end_positions(), (std::vector<ChunkOffset>{3, 5, 9, 10}));
+
+  for (auto i = 0u; i < vc_int->size(); ++i) {
+    EXPECT_EQ(rl_col->get(i), vc_int->values()[i]);
+    EXPECT_EQ((*rl_col)[i], (*vc_int)[i]);
+  }
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressStringColumn) {
+  RunLengthColumn<std::string> rl_col(vc_str);
+
+  EXPECT_EQ(rl_col.size(), 5u);
+  EXPECT_EQ(rl_col.run_count(), 2u);
+  EXPECT_EQ(rl_col.get(1), "a");
+  EXPECT_EQ(rl_col.get(2), "b");
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressEmptyColumn) {
+  RunLengthColumn<int> rl_col(std::make_shared<ValueColumn<int>>());
+  EXPECT_EQ(rl_col.size(), 0u);
+  EXPECT_EQ(rl_col.run_count(), 0u);
+}
+
+TEST_F(StorageRunLengthColumnTest, ThrowOnWrongInitialization) {
+  EXPECT_THROW((make_shared_by_column_type<BaseColumn, RunLengthColumn>("float", vc_int)), std::exception);
+}
+
+TEST_F(StorageRunLengthColumnTest, ThrowOnAppend) {
+  RunLengthColumn<int> rl_col(vc_int);
+  EXPECT_THROW(rl_col.append(1), std::exception);
+}
+
+TEST_F(StorageRunLengthColumnTest, Scan) {
+  RunLengthColumn<int> rl_col(vc_int);
+
+  PosList pos_list;
+  rl_col.scan(ScanType::OpEquals, 2, ChunkID{3}, pos_list);
+  EXPECT_EQ(pos_list, (PosList{{ChunkID{3}, 5}, {ChunkID{3}, 6}, {ChunkID{3}, 7}, {ChunkID{3}, 8}}));
+
+  pos_list.clear();
+  rl_col.scan(ScanType::OpGreaterThanEquals, 2, ChunkID{0}, pos_list);
+  EXPECT_EQ(pos_list.size(), 6u);
+  EXPECT_EQ(pos_list.front().chunk_offset, 3u);
+
+  pos_list.clear();
+  rl_col.scan(ScanType::OpNotEquals, 1, ChunkID{0}, pos_list);
+  EXPECT_EQ(pos_list.size(), 6u);
+
+  pos_list.clear();
+  rl_col.scan(ScanType::OpLessThan, 1, ChunkID{0}, pos_list);
+  EXPECT_TRUE(pos_list.empty());
+}
+
+TEST_F(StorageRunLengthColumnTest, CompressChunkOfTable) {
+  Table table{4};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+  table.append({1, "x"});
+  table.append({1, "x"});
+  table.append({2, "y"});
+
+  table.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  const auto& chunk = table.get_chunk(ChunkID{0});
+  const auto int_col = std::dynamic_pointer_cast<RunLengthColumn<int>>(chunk.get_column(ColumnID{0}));
+  const auto str_col = std::dynamic_pointer_cast<RunLengthColumn<std::string>>(chunk.get_column(ColumnID{1}));
+  ASSERT_NE(int_col, nullptr);
+  ASSERT_NE(str_col, nullptr);
+  EXPECT_EQ(int_col->run_count(), 2u);
+  EXPECT_EQ(str_col->get(2), "y");
+}
+
+TEST_F(StorageRunLengthColumnTest, NullValues) {
+  auto vc_nullable = std::make_shared<ValueColumn<int>>(true);
+  for (auto value : std::vector<AllTypeVariant>{NULL_VALUE, 1, 1, NULL_VALUE, 1, 2, NULL_VALUE}) {
+    vc_nullable->append(value);
+  }
+
+  // NULLs are part of the runs of their neighbours
+  RunLengthColumn<int> rl_col(vc_nullable);
+  EXPECT_EQ(rl_col.values(), (std::vector<int>{1, 2}));
+  EXPECT_EQ(rl_col.end_positions(), (std::vector<ChunkOffset>{5, 7}));
+  EXPECT_TRUE(variant_is_null(rl_col[3]));
+  EXPECT_EQ(type_cast<int>(rl_col[4]), 1);
+
+  PosList pos_list;
+  rl_col.scan(ScanType::OpEquals, 1, ChunkID{0}, pos_list);
+  EXPECT_EQ(pos_list, (PosList{{ChunkID{0}, 1}, {ChunkID{0}, 2}, {ChunkID{0}, 4}}));
+
+  pos_list.clear();
+  rl_col.scan(ScanType::OpGreaterThan, 1, ChunkID{0}, pos_list);
+  EXPECT_EQ(pos_list, (PosList{{ChunkID{0}, 5}}));
+}
+
+}  // namespace opossum
@@ -1,10 +1,15 @@
+#include <filesystem>
+#include <iterator>
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "../lib/storage/storage_manager.hpp"
 #include "../lib/storage/table.hpp"
+#include "../lib/utils/load_table.hpp"
 
 namespace opossum {
 
@@ -57,4 +62,102 @@ TEST_F(StorageStorageManagerTest, TableNames) {
   EXPECT_EQ(table_names[1], "second_table");
 }
 
+TEST_F(StorageStorageManagerTest, EstimateMemoryUsage) {
+  auto& sm = StorageManager::get();
+  const auto empty_usage = sm.estimate_memory_usage();
+
+  auto table = std::make_shared<Table>(500);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (int i = 0; i < 1'000; ++i) table->append({i % 3, "a string that is too long to be stored inline"});
+  sm.add_table("third_table", table);
+
+  // the values and the heap payload of the strings
+  const auto& uncompressed_chunk = table->get_chunk(ChunkID{1});
+  EXPECT_GT(uncompressed_chunk.estimate_memory_usage(), 500 * (sizeof(int) + sizeof(std::string) + 45));
+
+  table->compress_chunk(ChunkID{0});
+  EXPECT_LT(table->get_chunk(ChunkID{0}).estimate_memory_usage(), uncompressed_chunk.estimate_memory_usage() / 10);
+
+  const auto breakdown = sm.estimate_memory_usage_breakdown();
+  EXPECT_GT(breakdown.at("Dictionary"), 0u);
+  EXPECT_GT(breakdown.at("Unencoded"), 0u);
+  EXPECT_EQ(breakdown.count("RunLength"), 0u);
+  EXPECT_EQ(sm.estimate_memory_usage(), empty_usage + table->estimate_memory_usage());
+
+  std::stringstream output;
+  sm.print(output);
+  EXPECT_NE(output.str().find("#bytes:" + std::to_string(table->estimate_memory_usage()) + " (Dictionary: "),
+            std::string::npos);
+}
+
+TEST_F(StorageStorageManagerTest, CheckpointAndRestore) {
+  auto& sm = StorageManager::get();
+  const auto directory = testing::TempDir() + "storage_manager_test_checkpoint";
+  std::filesystem::remove_all(directory);
+
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  sm.add_table("int_float", table);
+  sm.checkpoint(directory, 2);
+
+  StorageManager::reset();
+  StorageManager::get().restore(directory, 2);
+  EXPECT_EQ(sm.table_names(), (std::vector<std::string>{"first_table", "int_float", "second_table"}));
+  EXPECT_TABLE_EQ(sm.get_table("int_float"), table, true);
+  EXPECT_EQ(sm.get_table("second_table")->chunk_size(), 4u);
+  EXPECT_EQ(sm.get_table("int_float")->get_chunk(ChunkID{0}).get_column(ColumnID{0})->encoding_name(),
+            "FrameOfReference");
+  EXPECT_THROW(sm.restore(directory), std::logic_error);
+
+  // replace the checkpoint while the restored tables still refer to its files
+  const auto restored_table = sm.get_table("int_float");
+  sm.drop_table("first_table");
+  sm.checkpoint(directory);
+  EXPECT_TABLE_EQ(restored_table, table, true);
+  // only the manifest and the files of the two tables of the new checkpoint are left
+  const auto file_count = std::distance(std::filesystem::directory_iterator{directory}, {});
+  EXPECT_EQ(file_count, 3);
+
+  StorageManager::reset();
+  StorageManager::get().restore(directory);
+  EXPECT_EQ(sm.table_names(), (std::vector<std::string>{"int_float", "second_table"}));
+  EXPECT_TABLE_EQ(sm.get_table("int_float"), table, true);
+
+  std::filesystem::remove_all(directory);
+  EXPECT_THROW(sm.restore(directory), std::logic_error);
+}
+
+TEST_F(StorageStorageManagerTest, FailedCheckpointKeepsPreviousCheckpoint) {
+  auto& sm = StorageManager::get();
+  const auto directory = testing::TempDir() + "storage_manager_test_failed_checkpoint";
+  std::filesystem::remove_all(directory);
+
+  const auto first_table = sm.get_table("first_table");
+  sm.checkpoint(directory, 2);
+
+  // a directory in place of a table file of the next checkpoint lets writing that table fail, after the other table
+  // may have been written
+  sm.drop_table("first_table");
+  sm.add_table("first_table", load_table("src/test/tables/int_float.tbl", 2));
+  std::filesystem::create_directory(std::filesystem::path{directory} / "table_1_1.bin");
+  EXPECT_THROW(sm.checkpoint(directory, 2), std::logic_error);
+  EXPECT_FALSE(std::filesystem::exists(std::filesystem::path{directory} / "table_1_0.bin"));
+
+  StorageManager::reset();
+  StorageManager::get().restore(directory, 2);
+  EXPECT_EQ(sm.table_names(), (std::vector<std::string>{"first_table", "second_table"}));
+  EXPECT_TABLE_EQ(sm.get_table("first_table"), first_table, true);
+
+  // once the obstacle is gone, the next checkpoint replaces the previous one
+  std::filesystem::remove(std::filesystem::path{directory} / "table_1_1.bin");
+  sm.drop_table("second_table");
+  sm.checkpoint(directory);
+  StorageManager::reset();
+  StorageManager::get().restore(directory);
+  EXPECT_EQ(sm.table_names(), (std::vector<std::string>{"first_table"}));
+
+  std::filesystem::remove_all(directory);
+}
+
 }  // namespace opossum
@@ -0,0 +1,47 @@
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/string_dictionary.hpp"
+
+namespace opossum {
+
+class StorageStringDictionaryTest : public BaseTest {
+ protected:
+  StringDictionary dictionary{std::vector<std::string>{"", "Alexander", "Bill", "Hasso", "Steve with a long name"}};
+};
+
+TEST_F(StorageStringDictionaryTest, Layout) {
+  EXPECT_EQ(dictionary.size(), 5u);
+  EXPECT_EQ(dictionary.data().size(), 40u);
+  const auto& offsets = dictionary.offsets();
+  EXPECT_EQ(std::vector<uint32_t>(offsets.begin(), offsets.end()), (std::vector<uint32_t>{0, 0, 9, 13, 18, 40}));
+}
+
+TEST_F(StorageStringDictionaryTest, Access) {
+  EXPECT_EQ(dictionary[0], "");
+  EXPECT_EQ(dictionary[1], "Alexander");
+  EXPECT_EQ(dictionary.at(4), "Steve with a long name");
+  EXPECT_THROW(dictionary.at(5), std::out_of_range);
+}
+
+TEST_F(StorageStringDictionaryTest, LowerUpperBound) {
+  EXPECT_EQ(dictionary.lower_bound(""), 0u);
+  EXPECT_EQ(dictionary.upper_bound(""), 1u);
+  EXPECT_EQ(dictionary.lower_bound("Bill"), 2u);
+  EXPECT_EQ(dictionary.upper_bound("Bill"), 3u);
+  EXPECT_EQ(dictionary.lower_bound("Bob"), 3u);
+  EXPECT_EQ(dictionary.upper_bound("Bob"), 3u);
+  EXPECT_EQ(dictionary.lower_bound("Zed"), 5u);
+  EXPECT_EQ(dictionary.upper_bound("Zed"), 5u);
+}
+
+TEST_F(StorageStringDictionaryTest, Empty) {
+  StringDictionary empty_dictionary{std::vector<std::string>{}};
+  EXPECT_EQ(empty_dictionary.size(), 0u);
+  EXPECT_EQ(empty_dictionary.lower_bound("a"), 0u);
+}
+
+}  // namespace opossum
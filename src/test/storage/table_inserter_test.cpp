@@ -0,0 +1,121 @@
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/table_inserter.hpp"
+
+namespace opossum {
+
+class StorageTableInserterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t.add_column("col_1", "int");
+    t.add_column("col_2", "string");
+  }
+
+  Table t{3};
+};
+
+TEST_F(StorageTableInserterTest, PublishesFullChunks) {
+  TableInserter inserter(t);
+  inserter.append({1, "a"});
+  inserter.append({2, "b"});
+  EXPECT_EQ(inserter.pending_row_count(), 2u);
+  EXPECT_EQ(t.row_count(), 0u);
+
+  // the initial empty chunk adopts the columns of the first published chunk
+  inserter.append({3, "c"});
+  EXPECT_EQ(inserter.pending_row_count(), 0u);
+  EXPECT_EQ(t.chunk_count(), 1u);
+  EXPECT_EQ(t.row_count(), 3u);
+
+  inserter.append({4, "d"});
+  inserter.flush();
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).size(), 1u);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{1}).get_column(ColumnID{1}))[0]), "d");
+}
+
+TEST_F(StorageTableInserterTest, KeepsFirstChunkValid) {
+  const auto& first_chunk = t.get_chunk(ChunkID{0});
+
+  // a concurrent reader that holds on to the empty first chunk sees either no rows or all columns filled
+  std::atomic_bool is_done{false};
+  std::thread reader([&]() {
+    while (!is_done) {
+      if (first_chunk.size() == 0) continue;
+      EXPECT_EQ(first_chunk.get_column(ColumnID{1})->size(), 3u);
+    }
+  });
+
+  {
+    TableInserter inserter(t);
+    inserter.append({1, "a"});
+    inserter.append({2, "b"});
+    inserter.append({3, "c"});
+    inserter.append({4, "d"});
+  }
+  is_done = true;
+  reader.join();
+
+  EXPECT_EQ(&t.get_chunk(ChunkID{0}), &first_chunk);
+  EXPECT_EQ(first_chunk.size(), 3u);
+  EXPECT_EQ(type_cast<std::string>((*first_chunk.get_column(ColumnID{1}))[2]), "c");
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
+TEST_F(StorageTableInserterTest, FlushesOnDestruction) {
+  {
+    TableInserter inserter(t);
+    inserter.append({1, "a"});
+  }
+  EXPECT_EQ(t.row_count(), 1u);
+
+  // flushing an empty inserter does not add a chunk
+  TableInserter inserter(t);
+  inserter.flush();
+  EXPECT_EQ(t.chunk_count(), 1u);
+}
+
+TEST_F(StorageTableInserterTest, ConcurrentWriters) {
+  constexpr auto writer_count = 8;
+  constexpr auto rows_per_writer = 999;
+  t.enable_background_compression();
+
+  std::vector<std::thread> writers;
+  for (auto writer_index = 0; writer_index < writer_count; ++writer_index) {
+    writers.emplace_back([&, writer_index]() {
+      TableInserter inserter(t);
+      for (auto row = 0; row < rows_per_writer; ++row) {
+        inserter.append({writer_index * rows_per_writer + row, std::to_string(writer_index)});
+      }
+    });
+  }
+  for (auto& writer : writers) writer.join();
+  t.wait_for_background_compression();
+
+  EXPECT_EQ(t.row_count(), static_cast<uint64_t>(writer_count * rows_per_writer));
+  EXPECT_EQ(t.chunk_count(), static_cast<uint32_t>(writer_count * rows_per_writer / 3));
+
+  // every row was inserted exactly once and all chunks, being full, have been compressed
+  std::vector<int> seen(writer_count * rows_per_writer, 0);
+  for (ChunkID chunk_id{0}; chunk_id < t.chunk_count(); ++chunk_id) {
+    const auto column = std::dynamic_pointer_cast<DictionaryColumn<int>>(t.get_chunk(chunk_id).get_column(ColumnID{0}));
+    ASSERT_NE(column, nullptr);
+    for (size_t offset = 0; offset < column->size(); ++offset) {
+      ++seen[column->get(offset)];
+    }
+  }
+  for (const auto count : seen) {
+    EXPECT_EQ(count, 1);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/table_statistics.hpp"
+
+namespace opossum {
+
+class StorageTableStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a uniformly distributed int column with 1000 distinct values and a skewed string column
+    table = std::make_shared<Table>(10'000);
+    table->add_column("uniform", "int");
+    table->add_column("skewed", "string");
+    for (int i = 0; i < 50'000; ++i) {
+      table->append({(i * 7919) % 1000, i % 2 == 0 ? std::string("frequent") : "rare" + std::to_string(i % 500)});
+    }
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(StorageTableStatisticsTest, SampledValueColumns) {
+  const auto& statistics = table->table_statistics();
+
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 500), 0.5, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 900), 0.1, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 42), 0.001, 0.001);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, 5000), 0);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThan, 1000), 0);
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{0}), 1000, 100);
+
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "frequent"), 0.5, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpNotEquals, "frequent"), 0.5, 0.02);
+  EXPECT_NEAR(statistics.estimate_row_count(ColumnID{1}, ScanType::OpEquals, "frequent"), 25'000, 500);
+}
+
+TEST_F(StorageTableStatisticsTest, DictionaryColumnsAreExact) {
+  table->compress_chunks(ChunkID{0}, table->chunk_count(), 1);
+  const auto& statistics = table->table_statistics();
+
+  EXPECT_FLOAT_EQ(statistics.estimate_distinct_count(ColumnID{0}), 1000);
+  EXPECT_FLOAT_EQ(statistics.estimate_distinct_count(ColumnID{1}), 251);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThanEquals, 499), 0.5, 0.01);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{1}, ScanType::OpEquals, "frequent"), 0.5, 0.001);
+}
+
+TEST_F(StorageTableStatisticsTest, RefreshedWhenChunksChange) {
+  const auto& statistics = table->table_statistics();
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 1000), 0, 0.001);
+
+  // another 50000 rows with values in [1000, 2000) double the value range
+  for (int i = 0; i < 50'000; ++i) table->append({1000 + i % 1000, "new"});
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 1000), 0.5, 0.02);
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{0}), 2000, 200);
+
+  table->compress_chunk(ChunkID{0});
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 1000), 0.5, 0.02);
+}
+
+TEST_F(StorageTableStatisticsTest, EmptyTable) {
+  Table empty_table;
+  empty_table.add_column("a", "double");
+  EXPECT_FLOAT_EQ(empty_table.table_statistics().estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, 1.0), 0);
+  EXPECT_FLOAT_EQ(empty_table.table_statistics().estimate_distinct_count(ColumnID{0}), 0);
+}
+
+TEST_F(StorageTableStatisticsTest, NullValues) {
+  auto nullable_table = std::make_shared<Table>(1'000);
+  nullable_table->add_column("a", "int", true);
+  for (int i = 0; i < 4'000; ++i) nullable_table->append({i % 4 == 0 ? NULL_VALUE : AllTypeVariant{i % 100}});
+  nullable_table->compress_chunk(ChunkID{0});
+  nullable_table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  // the estimates are fractions of all rows, of which a quarter is NULL and never matches
+  const auto& statistics = nullable_table->table_statistics();
+  EXPECT_FLOAT_EQ(statistics.null_fraction(ColumnID{0}), 0.25f);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 50), 0.375, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, 1), 0.74, 0.01);
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{0}), 75, 10);
+}
+
+TEST_F(StorageTableStatisticsTest, NaNValues) {
+  auto float_table = std::make_shared<Table>(1'000);
+  float_table->add_column("a", "float");
+  for (int i = 0; i < 4'000; ++i) {
+    float_table->append({i % 4 == 0 ? std::numeric_limits<float>::quiet_NaN() : static_cast<float>(i % 100)});
+  }
+  float_table->compress_chunk(ChunkID{0});
+  float_table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  // a quarter of the rows is NaN, which is neither part of the histogram nor a distinct value and only matches
+  // OpNotEquals
+  const auto& statistics = float_table->table_statistics();
+  EXPECT_FLOAT_EQ(statistics.nan_fraction(ColumnID{0}), 0.25f);
+  EXPECT_FLOAT_EQ(statistics.null_fraction(ColumnID{0}), 0);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpLessThan, 50.0f), 0.375, 0.02);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpGreaterThanEquals, 0.0f), 0.75, 0.01);
+  EXPECT_NEAR(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, 1.0f), 0.99, 0.01);
+  EXPECT_NEAR(statistics.estimate_distinct_count(ColumnID{0}), 75, 10);
+
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpEquals, nan), 0);
+  EXPECT_FLOAT_EQ(statistics.estimate_selectivity(ColumnID{0}, ScanType::OpNotEquals, nan), 1);
+}
+
+}  // namespace opossum
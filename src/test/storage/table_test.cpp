@@ -1,6 +1,8 @@
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -72,6 +74,39 @@ TEST_F(StorageTableTest, GetColumnIdByName) {
 
 TEST_F(StorageTableTest, GetChunkSize) { EXPECT_EQ(t.chunk_size(), 2u); }
 
+TEST_F(StorageTableTest, AppendColumns) {
+  t.append({1, "a"});
+  t.append_columns(std::vector<int32_t>{2, 3, 4, 5}, std::vector<std::string>{"b", "c", "d", "e"});
+
+  // the first chunk is filled up before new chunks are created
+  EXPECT_EQ(t.row_count(), 5u);
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{2}).size(), 1u);
+  EXPECT_EQ(type_cast<int32_t>((*t.get_chunk(ChunkID{0}).get_column(ColumnID{0}))[1]), 2);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{2}).get_column(ColumnID{1}))[0]), "e");
+}
+
+TEST_F(StorageTableTest, AppendColumnsWithoutChunkSize) {
+  Table table;
+  table.add_column("col_1", "double");
+
+  std::vector<double> values(100, 1.5);
+  const auto data = values.data();
+  table.append_columns(std::move(values));
+  EXPECT_EQ(table.chunk_count(), 1u);
+
+  const auto& column = dynamic_cast<const ValueColumn<double>&>(*table.get_chunk(ChunkID{0}).get_column(ColumnID{0}));
+  EXPECT_EQ(column.values().data(), data);
+}
+
+TEST_F(StorageTableTest, AppendColumnsWithWrongTypes) {
+  EXPECT_THROW(t.append_columns(std::vector<int32_t>{1}), std::exception);
+  EXPECT_THROW(t.append_columns(std::vector<int64_t>{1}, std::vector<std::string>{"a"}), std::exception);
+  EXPECT_THROW(t.append_columns(std::vector<int32_t>{1, 2}, std::vector<std::string>{"a"}), std::exception);
+  EXPECT_EQ(t.row_count(), 0u);
+}
+
 TEST_F(StorageTableTest, CompressChunk) {
   t.append({4, "Hello,"});
   t.compress_chunk(ChunkID(0));
@@ -82,4 +117,122 @@ TEST_F(StorageTableTest, CompressChunk) {
   EXPECT_TRUE(dict_col_ptr != nullptr);
 }
 
+TEST_F(StorageTableTest, CompressChunkSkipsEncodedColumns) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.compress_chunk(ChunkID(0), EncodingType::RunLength);
+  const auto encoded_column = t.get_chunk(ChunkID(0)).get_column(ColumnID(0));
+
+  // e.g., when a chunk has already been compressed by the background compression
+  EXPECT_NO_THROW(t.compress_chunk(ChunkID(0)));
+  EXPECT_NO_THROW(t.compress_chunks(ChunkID(0), ChunkID(1), 2));
+  EXPECT_EQ(t.get_chunk(ChunkID(0)).get_column(ColumnID(0)), encoded_column);
+  EXPECT_EQ(t.get_chunk(ChunkID(0)).get_column(ColumnID(1))->encoding_name(), "RunLength");
+}
+
+TEST_F(StorageTableTest, CompressChunks) {
+  for (int i = 0; i < 9; ++i) t.append({i, std::to_string(i % 2)});
+
+  const auto durations = t.compress_chunks(ChunkID{1}, ChunkID{4}, 4);
+  EXPECT_EQ(durations.size(), 3u);
+
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int>>(t.get_chunk(ChunkID{0}).get_column(ColumnID{0})), nullptr);
+  for (ChunkID chunk_id{1}; chunk_id < 4; ++chunk_id) {
+    const auto& chunk = t.get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1})), nullptr);
+  }
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int>>(t.get_chunk(ChunkID{4}).get_column(ColumnID{0})), nullptr);
+
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{2}).get_column(ColumnID{0}))[1]), 5);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{2}).get_column(ColumnID{1}))[1]), "1");
+}
+
+TEST_F(StorageTableTest, CompressChunksWithConcurrentReader) {
+  Table table{100};
+  table.add_column("a", "int");
+  for (int i = 0; i < 10000; ++i) table.append({i});
+
+  std::atomic<bool> done{false};
+  std::atomic<bool> mismatch{false};
+  std::thread reader([&]() {
+    while (!done) {
+      for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+        const auto column = table.get_chunk(chunk_id).get_column(ColumnID{0});
+        if (type_cast<int>((*column)[7]) != static_cast<int>(chunk_id * 100 + 7)) mismatch = true;
+      }
+    }
+  });
+
+  table.compress_chunks(ChunkID{0}, table.chunk_count(), 3);
+  done = true;
+  reader.join();
+
+  EXPECT_FALSE(mismatch);
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(table.get_chunk(chunk_id).get_column(ColumnID{0})),
+              nullptr);
+  }
+}
+
+TEST_F(StorageTableTest, BackgroundCompression) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  table->enable_background_compression();
+
+  for (int i = 0; i < 1050; ++i) table->append({i, std::to_string(i % 3)});
+  table->wait_for_background_compression();
+
+  EXPECT_EQ(table->chunk_count(), 11u);
+  EXPECT_EQ(table->row_count(), 1050u);
+  for (ChunkID chunk_id{0}; chunk_id < 10; ++chunk_id) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<int>>(chunk.get_column(ColumnID{0})), nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<DictionaryColumn<std::string>>(chunk.get_column(ColumnID{1})), nullptr);
+    EXPECT_EQ(type_cast<int>((*chunk.get_column(ColumnID{0}))[42]), static_cast<int>(chunk_id * 100 + 42));
+  }
+
+  // the chunk at the write head has not been sealed yet
+  const auto& last_chunk = table->get_chunk(ChunkID{10});
+  EXPECT_NE(std::dynamic_pointer_cast<ValueColumn<int>>(last_chunk.get_column(ColumnID{0})), nullptr);
+}
+
+TEST_F(StorageTableTest, BackgroundCompressionReportsErrors) {
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", "long");
+  // the compression of every chunk fails for an unknown encoding type
+  table->enable_background_compression(static_cast<EncodingType>(-1));
+
+  table->append({int64_t{0}});
+  table->append({int64_t{1}});
+  table->append({int64_t{2}});
+
+  EXPECT_THROW(table->wait_for_background_compression(), std::logic_error);
+}
+
+TEST_F(StorageTableTest, NumaPlacement) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).numa_node(), UNDEFINED_NODE_ID);
+
+  // an explicitly placed chunk keeps its node, even if the node does not exist on this machine
+  t.get_chunk(ChunkID{0}).set_numa_node(NodeID{numa_node_count()});
+  t.append({3, "!"});
+  t.set_numa_placement(NumaPlacement::RoundRobin);
+  t.append({5, "again"});
+  t.append({7, "and again"});
+
+  EXPECT_EQ(t.chunk_count(), 3u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).numa_node(), NodeID{numa_node_count()});
+  for (ChunkID chunk_id{1}; chunk_id < t.chunk_count(); ++chunk_id) {
+    EXPECT_EQ(t.get_chunk(chunk_id).numa_node(), NodeID{chunk_id % numa_node_count()});
+  }
+
+  // placed chunks are encoded on their node, falling back to the default resource for nodes that do not exist
+  t.compress_chunks(ChunkID{0}, ChunkID{2});
+  EXPECT_EQ(type_cast<int>((*t.get_chunk(ChunkID{0}).get_column(ColumnID{0}))[1]), 6);
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{1}).get_column(ColumnID{1}))[0]), "!");
+}
+
 }  // namespace opossum
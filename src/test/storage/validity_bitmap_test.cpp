@@ -0,0 +1,61 @@
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/validity_bitmap.hpp"
+
+namespace opossum {
+
+class StorageValidityBitmapTest : public BaseTest {};
+
+TEST_F(StorageValidityBitmapTest, AppendAndCount) {
+  ValidityBitmap bitmap(3);
+  bitmap.push_back(false);
+  bitmap.append(100, true);
+  bitmap.append(30, false);
+
+  EXPECT_EQ(bitmap.size(), 134u);
+  EXPECT_EQ(bitmap.null_count(), 31u);
+  EXPECT_TRUE(bitmap.is_valid(2));
+  EXPECT_FALSE(bitmap.is_valid(3));
+  EXPECT_TRUE(bitmap.is_valid(103));
+  EXPECT_FALSE(bitmap.is_valid(104));
+  EXPECT_FALSE(bitmap.is_valid(133));
+
+  // unused bits of the last word stay cleared
+  EXPECT_EQ(bitmap.word(2) >> (134 - 128), 0u);
+}
+
+TEST_F(StorageValidityBitmapTest, AllNull) {
+  ValidityBitmap bitmap(70, false);
+  EXPECT_EQ(bitmap.null_count(), 70u);
+  EXPECT_EQ(bitmap.word(0), 0u);
+  EXPECT_EQ(bitmap.word(1), 0u);
+}
+
+TEST_F(StorageValidityBitmapTest, ForEachValid) {
+  ValidityBitmap bitmap;
+  for (size_t i = 0; i < 200; ++i) bitmap.push_back(i % 3 == 0);
+
+  // ranges that start and end within words as well as at word boundaries
+  for (const auto& [begin, end] : std::vector<std::pair<size_t, size_t>>{{0, 200}, {5, 130}, {64, 128}, {70, 71}}) {
+    std::vector<size_t> valid_rows;
+    bitmap.for_each_valid(begin, end, [&](const size_t i) { valid_rows.push_back(i); });
+
+    std::vector<size_t> expected;
+    for (auto i = begin; i < end; ++i) {
+      if (i % 3 == 0) expected.push_back(i);
+    }
+    EXPECT_EQ(valid_rows, expected);
+  }
+}
+
+TEST_F(StorageValidityBitmapTest, ForEachSetBit) {
+  std::vector<size_t> positions;
+  ValidityBitmap::for_each_set_bit((uint64_t{1} << 63) | 0b1010, 128, [&](const size_t i) { positions.push_back(i); });
+  EXPECT_EQ(positions, (std::vector<size_t>{129, 131, 191}));
+}
+
+}  // namespace opossum
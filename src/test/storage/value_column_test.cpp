@@ -1,5 +1,6 @@
 #include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -47,9 +48,58 @@ TEST_F(StorageValueColumnTest, AddValueOfDifferentType) {
   EXPECT_THROW(vc_double.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueColumnTest, AppendBatch) {
+  std::vector<std::string> values{"Hello", "world"};
+  const auto data = values.data();
+  vc_str.append_batch(std::move(values));
+  EXPECT_EQ(vc_str.size(), 2u);
+  // an empty column takes over the buffer of the vector
+  EXPECT_EQ(vc_str.values().data(), data);
+
+  vc_str.append_batch({"!"});
+  EXPECT_EQ(vc_str.size(), 3u);
+  EXPECT_EQ(vc_str.values()[0], "Hello");
+  EXPECT_EQ(vc_str.values()[2], "!");
+}
+
 TEST_F(StorageValueColumnTest, GetValues) {
   vc_int.append(3);
   EXPECT_EQ(opossum::type_cast<int>(vc_int[0]), 3);
 }
 
+TEST_F(StorageValueColumnTest, NullValues) {
+  EXPECT_THROW(vc_int.append(NULL_VALUE), std::logic_error);
+  EXPECT_EQ(vc_int.validity(), nullptr);
+
+  ValueColumn<int> nullable_column(true);
+  nullable_column.append(1);
+  nullable_column.append(NULL_VALUE);
+  nullable_column.append_batch({3, 4});
+
+  EXPECT_TRUE(nullable_column.is_nullable());
+  EXPECT_EQ(nullable_column.size(), 4u);
+  EXPECT_EQ(nullable_column.validity()->null_count(), 1u);
+  EXPECT_FALSE(nullable_column.is_null(0));
+  EXPECT_TRUE(nullable_column.is_null(1));
+  EXPECT_TRUE(variant_is_null(nullable_column[1]));
+  EXPECT_EQ(type_cast<int>(nullable_column[3]), 4);
+
+  // NULLs do not widen the zone map
+  EXPECT_EQ(nullable_column.zone_map().min(), 1);
+}
+
+TEST_F(StorageValueColumnTest, EstimateMemoryUsage) {
+  const auto empty_usage = vc_str.estimate_memory_usage();
+  EXPECT_GE(empty_usage, sizeof(ValueColumn<std::string>));
+
+  vc_str.append_batch({"short", "short"});
+  const auto short_usage = vc_str.estimate_memory_usage();
+  EXPECT_EQ(short_usage, empty_usage + 2 * sizeof(std::string));
+
+  // long strings are counted with their heap buffers
+  vc_str.append_batch({std::string(1'000, 'x')});
+  EXPECT_GE(vc_str.estimate_memory_usage(), short_usage + sizeof(std::string) + 1'000);
+  EXPECT_EQ(vc_str.encoding_name(), "Unencoded");
+}
+
 }  // namespace opossum
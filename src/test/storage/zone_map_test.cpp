@@ -0,0 +1,135 @@
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/dictionary_column.hpp"
+#include "../lib/storage/frame_of_reference_column.hpp"
+#include "../lib/storage/run_length_column.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/storage/zone_map.hpp"
+
+namespace opossum {
+
+class StorageZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    zone_map.add(10);
+    zone_map.add(30);
+    zone_map.add(20);
+  }
+
+  ZoneMap<int> zone_map;
+};
+
+TEST_F(StorageZoneMapTest, MinMax) {
+  EXPECT_EQ(zone_map.min(), 10);
+  EXPECT_EQ(zone_map.max(), 30);
+
+  ZoneMap<int> empty_zone_map;
+  EXPECT_TRUE(empty_zone_map.is_empty());
+  EXPECT_EQ(empty_zone_map.match(ScanType::OpNotEquals, 5), ZoneMapMatch::None);
+}
+
+TEST_F(StorageZoneMapTest, Match) {
+  EXPECT_EQ(zone_map.match(ScanType::OpEquals, 5), ZoneMapMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpEquals, 20), ZoneMapMatch::Partial);
+  EXPECT_EQ(zone_map.match(ScanType::OpNotEquals, 31), ZoneMapMatch::All);
+  EXPECT_EQ(zone_map.match(ScanType::OpNotEquals, 30), ZoneMapMatch::Partial);
+
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThan, 10), ZoneMapMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThan, 30), ZoneMapMatch::Partial);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThan, 31), ZoneMapMatch::All);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThanEquals, 9), ZoneMapMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThanEquals, 10), ZoneMapMatch::Partial);
+  EXPECT_EQ(zone_map.match(ScanType::OpLessThanEquals, 30), ZoneMapMatch::All);
+
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThan, 30), ZoneMapMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThan, 10), ZoneMapMatch::Partial);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThan, 9), ZoneMapMatch::All);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThanEquals, 31), ZoneMapMatch::None);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThanEquals, 30), ZoneMapMatch::Partial);
+  EXPECT_EQ(zone_map.match(ScanType::OpGreaterThanEquals, 10), ZoneMapMatch::All);
+}
+
+TEST_F(StorageZoneMapTest, SingleValue) {
+  ZoneMap<std::string> single_value;
+  single_value.add("abc");
+  EXPECT_EQ(single_value.match(ScanType::OpEquals, "abc"), ZoneMapMatch::All);
+  EXPECT_EQ(single_value.match(ScanType::OpNotEquals, "abc"), ZoneMapMatch::None);
+}
+
+TEST_F(StorageZoneMapTest, NaN) {
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  ZoneMap<float> nan_first;
+  for (const auto value : {nan, 1.f, 2.f}) nan_first.add(value);
+  EXPECT_TRUE(nan_first.has_nan());
+  EXPECT_EQ(nan_first.min(), 1.f);
+  EXPECT_EQ(nan_first.max(), 2.f);
+  EXPECT_EQ(nan_first.match(ScanType::OpEquals, 5.f), ZoneMapMatch::None);
+  EXPECT_EQ(nan_first.match(ScanType::OpLessThan, 3.f), ZoneMapMatch::Partial);
+  EXPECT_EQ(nan_first.match(ScanType::OpGreaterThan, 0.f), ZoneMapMatch::Partial);
+  EXPECT_EQ(nan_first.match(ScanType::OpNotEquals, 1.f), ZoneMapMatch::Partial);
+
+  ZoneMap<float> only_nan;
+  only_nan.add(nan);
+  EXPECT_TRUE(only_nan.is_empty());
+  EXPECT_EQ(only_nan.match(ScanType::OpEquals, 1.f), ZoneMapMatch::None);
+  EXPECT_EQ(only_nan.match(ScanType::OpNotEquals, 1.f), ZoneMapMatch::Partial);
+
+  // NaNs are detected wherever the sort order of the dictionary put them
+  const auto value_column = std::make_shared<ValueColumn<float>>();
+  value_column->append_batch({2.f, nan, 1.f});
+  EXPECT_EQ(DictionaryColumn<float>(value_column).match_zone_map(ScanType::OpLessThan, 3.f), ZoneMapMatch::Partial);
+  EXPECT_EQ(RunLengthColumn<float>(value_column).match_zone_map(ScanType::OpLessThan, 3.f), ZoneMapMatch::Partial);
+}
+
+TEST_F(StorageZoneMapTest, MaintainedByColumns) {
+  auto value_column = std::make_shared<ValueColumn<int>>();
+  value_column->append(7);
+  value_column->append_batch({3, 9, 5});
+  EXPECT_EQ(value_column->zone_map().min(), 3);
+  EXPECT_EQ(value_column->zone_map().max(), 9);
+  EXPECT_EQ(value_column->match_zone_map(ScanType::OpGreaterThan, 9), ZoneMapMatch::None);
+
+  const auto expect_bounds = [](const auto& column) {
+    EXPECT_EQ(column.zone_map().min(), 3);
+    EXPECT_EQ(column.zone_map().max(), 9);
+  };
+  expect_bounds(DictionaryColumn<int>(value_column));
+  expect_bounds(RunLengthColumn<int>(value_column));
+  expect_bounds(FrameOfReferenceColumn<int>(value_column));
+
+  // the search value is converted into the type of the column
+  EXPECT_EQ(DictionaryColumn<int>(value_column).match_zone_map(ScanType::OpLessThan, 2.5), ZoneMapMatch::None);
+}
+
+TEST_F(StorageZoneMapTest, NullCount) {
+  auto value_column = std::make_shared<ValueColumn<int>>(true);
+  value_column->append_batch({3, 9});
+  EXPECT_EQ(value_column->zone_map().null_count(), 0u);
+  EXPECT_EQ(value_column->match_zone_map(ScanType::OpLessThan, 10), ZoneMapMatch::All);
+
+  // the NULL rows do not match, the ValidityBitmap has to be consulted for the others
+  value_column->append(NULL_VALUE);
+  value_column->append(NULL_VALUE);
+  EXPECT_EQ(value_column->zone_map().null_count(), 2u);
+  EXPECT_EQ(value_column->match_zone_map(ScanType::OpLessThan, 10), ZoneMapMatch::AllValid);
+  EXPECT_EQ(value_column->match_zone_map(ScanType::OpLessThan, 5), ZoneMapMatch::Partial);
+
+  const auto expect_null_count = [](const auto& column) { EXPECT_EQ(column.zone_map().null_count(), 2u); };
+  expect_null_count(DictionaryColumn<int>(value_column));
+  expect_null_count(RunLengthColumn<int>(value_column));
+  expect_null_count(FrameOfReferenceColumn<int>(value_column));
+
+  // a column of NULLs only never matches
+  auto null_column = std::make_shared<ValueColumn<int>>(true);
+  null_column->append(NULL_VALUE);
+  EXPECT_EQ(null_column->match_zone_map(ScanType::OpNotEquals, 1), ZoneMapMatch::None);
+  EXPECT_EQ(DictionaryColumn<int>(null_column).match_zone_map(ScanType::OpNotEquals, 1), ZoneMapMatch::None);
+}
+
+}  // namespace opossum
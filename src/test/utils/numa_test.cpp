@@ -0,0 +1,51 @@
+#include <sched.h>
+
+#include <memory_resource>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/column_memory_resource.hpp"
+#include "../lib/utils/numa.hpp"
+
+namespace opossum {
+
+class UtilsNumaTest : public BaseTest {};
+
+TEST_F(UtilsNumaTest, ParseCpuList) {
+  EXPECT_EQ(parse_cpu_list(""), (std::vector<uint32_t>{}));
+  EXPECT_EQ(parse_cpu_list("0"), (std::vector<uint32_t>{0}));
+  EXPECT_EQ(parse_cpu_list("0-3,8,10-11"), (std::vector<uint32_t>{0, 1, 2, 3, 8, 10, 11}));
+}
+
+TEST_F(UtilsNumaTest, NodeMemoryResource) {
+  EXPECT_GE(numa_node_count(), 1u);
+
+  // memory of every node is usable, nodes that do not exist fall back to the default resource
+  for (NodeID node{0}; node < numa_node_count(); ++node) {
+    std::pmr::vector<int64_t> values(100000, 42, numa_memory_resource(node));
+    EXPECT_EQ(values[99999], 42);
+  }
+  EXPECT_EQ(numa_memory_resource(NodeID{numa_node_count()}), column_memory_resource());
+}
+
+TEST_F(UtilsNumaTest, ScopedAffinityRestoresPreviousAffinity) {
+  cpu_set_t before;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(before), &before), 0);
+
+  {
+    ScopedNumaAffinity affinity(NodeID{0});
+    // pinning only happens on machines with more than one node
+    if (numa_node_count() == 1) {
+      EXPECT_FALSE(affinity.is_pinned());
+    }
+  }
+  EXPECT_FALSE(ScopedNumaAffinity(UNDEFINED_NODE_ID).is_pinned());
+
+  cpu_set_t after;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(after), &after), 0);
+  EXPECT_TRUE(CPU_EQUAL(&before, &after));
+}
+
+}  // namespace opossum
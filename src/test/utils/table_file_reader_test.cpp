@@ -0,0 +1,158 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_column.hpp"
+#include "../lib/utils/load_table.hpp"
+#include "../lib/utils/table_file_reader.hpp"
+
+namespace opossum {
+
+class UtilsTableFileReaderTest : public BaseTest {
+ protected:
+  void TearDown() override { std::remove(_file_name.c_str()); }
+
+  void _write_file(const std::string& content) { std::ofstream(_file_name, std::ios::binary) << content; }
+
+  const std::string _file_name = testing::TempDir() + "utils_table_file_reader_test.tbl";
+};
+
+TEST_F(UtilsTableFileReaderTest, ParsesTypedColumns) {
+  _write_file(
+      "a|b|c|d|e\nint|long|float|double|string\n"
+      "1|-5000000000|1.5|-2.25|foo\n-2|7|0|1e3|\n3|0|-0.5|4|bar baz\n");
+
+  auto expected_table = std::make_shared<Table>(2);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "long");
+  expected_table->add_column("c", "float");
+  expected_table->add_column("d", "double");
+  expected_table->add_column("e", "string");
+  expected_table->append({1, int64_t{-5'000'000'000}, 1.5f, -2.25, "foo"});
+  expected_table->append({-2, int64_t{7}, 0.0f, 1000.0, ""});
+  expected_table->append({3, int64_t{0}, -0.5f, 4.0, "bar baz"});
+
+  const auto table = load_table(_file_name, 2);
+  EXPECT_TABLE_EQ(table, expected_table, true);
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}).size(), 2u);
+}
+
+TEST_F(UtilsTableFileReaderTest, ParsesNullableColumns) {
+  _write_file("a|b|c\nint_null|string_null|string\n1|null|null\nnull|x|y\n");
+
+  auto expected_table = std::make_shared<Table>(0);
+  expected_table->add_column("a", "int", true);
+  expected_table->add_column("b", "string", true);
+  expected_table->add_column("c", "string");
+  expected_table->append({1, NULL_VALUE, "null"});
+  expected_table->append({NULL_VALUE, "x", "y"});
+
+  // a single chunk concatenates the rows of all slices
+  const auto table = load_table(_file_name, 0);
+  EXPECT_TABLE_EQ(table, expected_table, true);
+  EXPECT_TRUE(table->column_is_nullable(ColumnID{0}));
+  EXPECT_FALSE(table->column_is_nullable(ColumnID{2}));
+  EXPECT_EQ(table->column_type(ColumnID{1}), "string");
+}
+
+TEST_F(UtilsTableFileReaderTest, StreamsChunksInOrder) {
+  std::string content = "a|b|\r\nint|string|\r\n";
+  for (int i = 0; i < 1000; ++i) content += std::to_string(i) + "|" + std::to_string(i % 7) + "|\r\n";
+  _write_file(content);
+
+  auto reader = TableFileReader{_file_name};
+  EXPECT_EQ(reader.column_names(), (std::vector<std::string>{"a", "b"}));
+  EXPECT_EQ(reader.column_types(), (std::vector<std::string>{"int", "string"}));
+
+  auto table = reader.create_table(30);
+  std::vector<size_t> batch_sizes;
+  while (const auto chunk_count = reader.read_chunks(30, 8, 4, [&](Chunk&& chunk) {
+           table->emplace_chunk(std::move(chunk));
+         })) {
+    batch_sizes.push_back(chunk_count);
+  }
+  EXPECT_TRUE(reader.at_end());
+  EXPECT_EQ(batch_sizes, (std::vector<size_t>{8, 8, 8, 8, 2}));
+
+  ASSERT_EQ(table->row_count(), 1000u);
+  EXPECT_EQ(table->chunk_count(), 34u);
+  EXPECT_EQ(table->get_chunk(ChunkID{33}).size(), 10u);
+  for (const auto& chunk_id : {ChunkID{0}, ChunkID{17}, ChunkID{33}}) {
+    const auto& chunk = table->get_chunk(chunk_id);
+    const auto first_row = static_cast<int>(chunk_id) * 30;
+    EXPECT_EQ((*chunk.get_column(ColumnID{0}))[0], AllTypeVariant{first_row});
+    EXPECT_EQ((*chunk.get_column(ColumnID{1}))[0], AllTypeVariant{std::to_string(first_row % 7)});
+  }
+}
+
+TEST_F(UtilsTableFileReaderTest, ReadsUnlimitedChunkSizeIntoOneChunk) {
+  _write_file("a\nint\n1\n2\n3");
+
+  const auto table = load_table(_file_name, 0);
+  EXPECT_EQ(table->chunk_count(), 1u);
+  EXPECT_EQ(table->row_count(), 3u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))[2], AllTypeVariant{3});
+}
+
+TEST_F(UtilsTableFileReaderTest, ParsesLargeChunkInSlices) {
+  // large enough to be split into several slices, which are parsed in parallel and concatenated
+  std::string content = "a|b\nint|string\n";
+  for (int i = 0; i < 400'000; ++i) content += std::to_string(i) + "|s\n";
+  _write_file(content);
+
+  const auto table = load_table(_file_name, 0, 4);
+  ASSERT_EQ(table->chunk_count(), 1u);
+  const auto& values = std::dynamic_pointer_cast<ValueColumn<int>>(table->get_chunk(ChunkID{0}).get_column(ColumnID{0}))
+                           ->values();
+  ASSERT_EQ(values.size(), 400'000u);
+  for (size_t index = 0; index < values.size(); ++index) {
+    ASSERT_EQ(values[index], static_cast<int>(index));
+  }
+}
+
+TEST_F(UtilsTableFileReaderTest, ReadsCsv) {
+  _write_file("a,b\nint,float\n1,2.5\n");
+
+  auto reader = TableFileReader{_file_name, ','};
+  auto table = reader.create_table(0);
+  EXPECT_EQ(reader.read_chunks(0, 1, 1, [&](Chunk&& chunk) { table->emplace_chunk(std::move(chunk)); }), 1u);
+  EXPECT_EQ(reader.read_chunks(0, 1, 1, [&](Chunk&&) { ADD_FAILURE(); }), 0u);
+  EXPECT_EQ((*table->get_chunk(ChunkID{0}).get_column(ColumnID{1}))[0], AllTypeVariant{2.5f});
+}
+
+TEST_F(UtilsTableFileReaderTest, EmptyTable) {
+  _write_file("a|b\nint|string\n");
+
+  const auto table = load_table(_file_name, 10);
+  EXPECT_EQ(table->col_count(), 2u);
+  EXPECT_EQ(table->row_count(), 0u);
+}
+
+TEST_F(UtilsTableFileReaderTest, RejectsInvalidFiles) {
+  EXPECT_THROW(load_table(_file_name + ".missing", 10), std::logic_error);
+
+  _write_file("a|b\nint\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a\nvarchar\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|int\n1|2\n3\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a|b\nint|int\n1|2|3\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+
+  _write_file("a\nint\n12x\n");
+  EXPECT_THROW(load_table(_file_name, 10), std::logic_error);
+}
+
+}  // namespace opossum